@@ -43,8 +43,13 @@
 #include <range/v3/view/enumerate.hpp>
 #include <range/v3/view/map.hpp>
 
+#include <algorithm>
+#include <atomic>
 #include <fstream>
+#include <functional>
+#include <future>
 #include <limits>
+#include <optional>
 #include <iterator>
 
 using namespace solidity;
@@ -700,6 +705,9 @@ std::map<u256, u256> const& Assembly::optimiseInternal(
 		return *m_tagReplacements;
 
 	// Run optimisation for sub-assemblies.
+	// If they were optimised concurrently, the loop only applies their tag replacements.
+	if (_settings.jobs > 1 && !m_subs.empty())
+		optimiseSubAssembliesConcurrently(_settings);
 	for (size_t subId = 0; subId < m_subs.size(); ++subId)
 	{
 		OptimiserSettings settings = _settings;
@@ -781,39 +789,65 @@ std::map<u256, u256> const& Assembly::optimiseInternal(
 				return _i == AssemblyItem{Instruction::MSIZE} || _i.type() == VerbatimBytecode;
 			});
 
-			auto iter = m_items.begin();
-			while (iter != m_items.end())
+			// The chunks are optimised independently, so they can be optimised concurrently
+			// and the results are combined in the original order.
+			std::vector<std::pair<AssemblyItems::const_iterator, AssemblyItems::const_iterator>> chunks;
+			for (auto iter = m_items.cbegin(); iter != m_items.cend();)
 			{
-				KnownState emptyState;
-				CommonSubexpressionEliminator eliminator{emptyState};
-				auto orig = iter;
-				iter = eliminator.feedItems(iter, m_items.end(), usesMSize);
-				bool shouldReplace = false;
-				AssemblyItems optimisedChunk;
-				try
-				{
-					optimisedChunk = eliminator.getOptimizedItems();
-					shouldReplace = (optimisedChunk.size() < static_cast<size_t>(iter - orig));
-				}
-				catch (StackTooDeepException const&)
-				{
-					// This might happen if the opcode reconstruction is not as efficient
-					// as the hand-crafted code.
-				}
-				catch (ItemNotAvailableException const&)
+				auto chunkBegin = iter;
+				iter = CommonSubexpressionEliminator::chunkEnd(iter, m_items.cend(), usesMSize);
+				chunks.emplace_back(chunkBegin, iter);
+			}
+
+			std::vector<std::optional<AssemblyItems>> optimisedChunks(chunks.size());
+			std::atomic<size_t> nextChunk = 0;
+			auto optimiseChunks = [&]() {
+				for (size_t i = nextChunk++; i < chunks.size(); i = nextChunk++)
 				{
-					// This might happen if e.g. associativity and commutativity rules
-					// reorganise the expression tree, but not all leaves are available.
+					auto const& [chunkBegin, chunkEnd] = chunks[i];
+					KnownState emptyState;
+					CommonSubexpressionEliminator eliminator{emptyState};
+					assertThrow(
+						eliminator.feedItems(chunkBegin, chunkEnd, usesMSize) == chunkEnd,
+						OptimizerException,
+						"Invalid chunk boundary."
+					);
+					try
+					{
+						AssemblyItems optimisedChunk = eliminator.getOptimizedItems();
+						if (optimisedChunk.size() < static_cast<size_t>(chunkEnd - chunkBegin))
+							optimisedChunks[i] = std::move(optimisedChunk);
+					}
+					catch (StackTooDeepException const&)
+					{
+						// This might happen if the opcode reconstruction is not as efficient
+						// as the hand-crafted code.
+					}
+					catch (ItemNotAvailableException const&)
+					{
+						// This might happen if e.g. associativity and commutativity rules
+						// reorganise the expression tree, but not all leaves are available.
+					}
 				}
-
-				if (shouldReplace)
+			};
+			// Starting threads only pays off if each of them has enough items to optimise.
+			size_t const minItemsPerThread = 1000;
+			size_t const threads = std::min({_settings.jobs, chunks.size(), m_items.size() / minItemsPerThread + 1});
+			std::vector<std::future<void>> workers;
+			for (size_t i = 1; i < threads; ++i)
+				workers.emplace_back(std::async(std::launch::async, optimiseChunks));
+			optimiseChunks();
+			for (auto& worker: workers)
+				worker.get();
+
+			for (size_t i = 0; i < chunks.size(); ++i)
+				if (optimisedChunks[i])
 				{
 					count++;
-					optimisedItems += optimisedChunk;
+					optimisedItems += *optimisedChunks[i];
 				}
 				else
-					copy(orig, iter, back_inserter(optimisedItems));
-			}
+					copy(chunks[i].first, chunks[i].second, back_inserter(optimisedItems));
 			if (optimisedItems.size() < m_items.size())
 			{
 				m_items = std::move(optimisedItems);
@@ -834,6 +868,65 @@ std::map<u256, u256> const& Assembly::optimiseInternal(
 	return *m_tagReplacements;
 }
 
+void Assembly::optimiseSubAssembliesConcurrently(OptimiserSettings const& _settings)
+{
+	struct Job
+	{
+		Assembly* assembly;
+		std::set<size_t> tagsReferencedFromOutside;
+		/// Length of the longest path to a sub-assembly that still has to be optimised.
+		size_t height = 0;
+	};
+	std::vector<Job> jobs;
+	std::map<Assembly const*, size_t> jobIndices;
+	// Visits the sub-assemblies in the same order as the recursion in optimiseInternal.
+	// @returns the height of a job for @a _assembly.
+	std::function<size_t(Assembly const&)> collectJobs = [&](Assembly const& _assembly) {
+		size_t height = 0;
+		for (size_t subId = 0; subId < _assembly.m_subs.size(); ++subId)
+		{
+			Assembly& sub = *_assembly.m_subs[subId];
+			if (sub.m_tagReplacements)
+				continue;
+			if (!jobIndices.count(&sub))
+			{
+				size_t index = jobs.size();
+				jobIndices[&sub] = index;
+				jobs.push_back({&sub, JumpdestRemover::referencedTags(_assembly.m_items, subId)});
+				jobs[index].height = collectJobs(sub);
+			}
+			height = std::max(height, jobs[jobIndices.at(&sub)].height + 1);
+		}
+		return height;
+	};
+	size_t const levels = collectJobs(*this);
+
+	// The sub-assemblies of an assembly have a lower height, so all jobs of the same height are independent.
+	for (size_t height = 0; height < levels; ++height)
+	{
+		std::vector<Job*> level;
+		for (Job& job: jobs)
+			if (job.height == height)
+				level.push_back(&job);
+
+		// Sub-assemblies that are optimised concurrently do not start further threads for their chunks.
+		OptimiserSettings jobSettings = _settings;
+		if (level.size() > 1)
+			jobSettings.jobs = 1;
+		std::atomic<size_t> nextJob = 0;
+		auto optimiseJobs = [&]() {
+			for (size_t i = nextJob++; i < level.size(); i = nextJob++)
+				level[i]->assembly->optimiseInternal(jobSettings, level[i]->tagsReferencedFromOutside);
+		};
+		std::vector<std::future<void>> workers;
+		for (size_t i = 1; i < std::min(_settings.jobs, level.size()); ++i)
+			workers.emplace_back(std::async(std::launch::async, optimiseJobs));
+		optimiseJobs();
+		for (auto& worker: workers)
+			worker.get();
+	}
+}
+
 LinkerObject const& Assembly::assemble() const
 {
 	assertThrow(!m_invalid, AssemblyException, "Attempted to assemble invalid Assembly object.");
@@ -1176,10 +1269,14 @@ Assembly const* Assembly::subAssemblyById(size_t _subId) const
 	return currentAssembly;
 }
 
-Assembly::OptimiserSettings Assembly::OptimiserSettings::translateSettings(frontend::OptimiserSettings const& _settings, langutil::EVMVersion const& _evmVersion)
+Assembly::OptimiserSettings Assembly::OptimiserSettings::translateSettings(
+	frontend::OptimiserSettings const& _settings,
+	langutil::EVMVersion const& _evmVersion,
+	size_t _jobs
+)
 {
 	// Constructing it this way so that we notice changes in the fields.
-	evmasm::Assembly::OptimiserSettings asmSettings{false,  false, false, false, false, false, _evmVersion, 0};
+	evmasm::Assembly::OptimiserSettings asmSettings{false,  false, false, false, false, false, _evmVersion, 0, 1};
 	asmSettings.runInliner = _settings.runInliner;
 	asmSettings.runJumpdestRemover = _settings.runJumpdestRemover;
 	asmSettings.runPeephole = _settings.runPeephole;
@@ -1188,5 +1285,10 @@ Assembly::OptimiserSettings Assembly::OptimiserSettings::translateSettings(front
 	asmSettings.runConstantOptimiser = _settings.runConstantOptimiser;
 	asmSettings.expectedExecutionsPerDeployment = _settings.expectedExecutionsPerDeployment;
 	asmSettings.evmVersion = _evmVersion;
+#ifndef __EMSCRIPTEN__
+	asmSettings.jobs = _jobs;
+#else
+	(void)_jobs;
+#endif
 	return asmSettings;
 }
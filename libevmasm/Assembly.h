@@ -128,8 +128,17 @@ public:
 		/// This specifies an estimate on how often each opcode in this assembly will be executed,
 		/// i.e. use a small value to optimise for size and a large value to optimise for runtime gas usage.
 		size_t expectedExecutionsPerDeployment = frontend::OptimiserSettings{}.expectedExecutionsPerDeployment;
-
-		static OptimiserSettings translateSettings(frontend::OptimiserSettings const& _settings, langutil::EVMVersion const& _evmVersion);
+		/// Maximum number of sub-assemblies that are optimised concurrently and of threads that
+		/// optimise the chunks of the common subexpression eliminator concurrently.
+		/// The result does not depend on this value.
+		size_t jobs = 1;
+
+		/// @param _jobs the value of jobs, which is ignored in Emscripten builds since they cannot start threads.
+		static OptimiserSettings translateSettings(
+			frontend::OptimiserSettings const& _settings,
+			langutil::EVMVersion const& _evmVersion,
+			size_t _jobs = 1
+		);
 	};
 
 	/// Modify and return the current assembly such that creation and execution gas usage
@@ -181,6 +190,12 @@ protected:
 	/// that are referenced in a super-assembly.
 	std::map<u256, u256> const& optimiseInternal(OptimiserSettings const& _settings, std::set<size_t> _tagsReferencedFromOutside);
 
+	/// Optimises all sub-assemblies below this assembly that have not been optimised yet on up to
+	/// @a _settings.jobs threads. Every sub-assembly is optimised with the tags referenced by the parent
+	/// through which optimiseInternal would reach it first, so that the result is the same as with
+	/// the recursive optimisation.
+	void optimiseSubAssembliesConcurrently(OptimiserSettings const& _settings);
+
 	unsigned codeSize(unsigned subTagSize) const;
 
 	/// Add all assembly items from given JSON array. This function imports the items by iterating through
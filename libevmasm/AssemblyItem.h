@@ -63,7 +63,7 @@ using AssemblyItems = std::vector<AssemblyItem>;
 class AssemblyItem
 {
 public:
-	enum class JumpType { Ordinary, IntoFunction, OutOfFunction };
+	enum class JumpType: uint8_t { Ordinary, IntoFunction, OutOfFunction };
 
 	AssemblyItem(u256 _push, langutil::DebugData::ConstPtr _debugData = langutil::DebugData::create()):
 		AssemblyItem(Push, std::move(_push), std::move(_debugData)) { }
@@ -79,12 +79,12 @@ public:
 		if (m_type == Operation)
 			m_instruction = Instruction(uint8_t(_data));
 		else
-			m_data = std::make_shared<u256>(std::move(_data));
+			m_data = std::move(_data);
 	}
 	explicit AssemblyItem(bytes _verbatimData, size_t _arguments, size_t _returnVariables):
 		m_type(VerbatimBytecode),
 		m_instruction{},
-		m_verbatimBytecode{{_arguments, _returnVariables, std::move(_verbatimData)}},
+		m_verbatimBytecode{std::make_shared<std::tuple<size_t, size_t, bytes> const>(_arguments, _returnVariables, std::move(_verbatimData))},
 		m_debugData{langutil::DebugData::create()}
 	{}
 
@@ -105,8 +105,8 @@ public:
 	void setPushTagSubIdAndTag(size_t _subId, size_t _tag);
 
 	AssemblyItemType type() const { return m_type; }
-	u256 const& data() const { assertThrow(m_type != Operation, util::Exception, ""); return *m_data; }
-	void setData(u256 const& _data) { assertThrow(m_type != Operation, util::Exception, ""); m_data = std::make_shared<u256>(_data); }
+	u256 const& data() const { assertThrow(m_type != Operation, util::Exception, ""); return m_data; }
+	void setData(u256 const& _data) { assertThrow(m_type != Operation, util::Exception, ""); m_data = _data; }
 
 	/// This function is used in `Assembly::assemblyJSON`.
 	/// It returns the name & data of the current assembly item.
@@ -215,12 +215,14 @@ private:
 
 	AssemblyItemType m_type;
 	Instruction m_instruction; ///< Only valid if m_type == Operation
-	std::shared_ptr<u256> m_data; ///< Only valid if m_type != Operation
+	JumpType m_jumpType = JumpType::Ordinary;
+	/// Only valid if m_type != Operation. Stored inline, since u256 has a fixed size and copying
+	/// it is cheaper than allocating and reference counting it for every push and tag.
+	u256 m_data;
 	/// If m_type == VerbatimBytecode, this holds number of arguments, number of
-	/// return variables and verbatim bytecode.
-	std::optional<std::tuple<size_t, size_t, bytes>> m_verbatimBytecode;
+	/// return variables and verbatim bytecode. Shared between copies, since it is never modified.
+	std::shared_ptr<std::tuple<size_t, size_t, bytes> const> m_verbatimBytecode;
 	langutil::DebugData::ConstPtr m_debugData;
-	JumpType m_jumpType = JumpType::Ordinary;
 	/// Pushed value for operations with data to be determined during assembly stage,
 	/// e.g. PushSubSize, PushTag, PushSub, etc.
 	mutable std::shared_ptr<u256> m_pushedValue;
@@ -27,8 +27,10 @@
 #include <libevmasm/AssemblyItem.h>
 #include <libevmasm/SemanticInformation.h>
 
-#include <functional>
-#include <set>
+#include <boost/container_hash/hash.hpp>
+
+#include <algorithm>
+#include <unordered_map>
 
 using namespace solidity;
 using namespace solidity::evmasm;
@@ -48,46 +50,63 @@ bool BlockDeduplicator::deduplicate()
 	)
 		return false;
 
-	std::function<bool(size_t, size_t)> comparator = [&](size_t _i, size_t _j)
+	// Calls @a _function with the range of items of the block that starts at index @a _i.
+	// To compare recursive loops, we have to already unify PushTag opcodes of the
+	// block's own tag.
+	auto withBlock = [&](size_t _i, auto&& _function)
 	{
-		if (_i == _j)
-			return false;
-
-		// To compare recursive loops, we have to already unify PushTag opcodes of the
-		// block's own tag.
-		AssemblyItem pushFirstTag{pushSelf};
-		AssemblyItem pushSecondTag{pushSelf};
-
+		AssemblyItem pushOwnTag{pushSelf};
 		if (_i < m_items.size() && m_items.at(_i).type() == Tag)
-			pushFirstTag = m_items.at(_i).pushTag();
-		if (_j < m_items.size() && m_items.at(_j).type() == Tag)
-			pushSecondTag = m_items.at(_j).pushTag();
+			pushOwnTag = m_items.at(_i).pushTag();
 
 		using diff_type = BlockIterator::difference_type;
-		BlockIterator first{m_items.begin() + diff_type(_i), m_items.end(), &pushFirstTag, &pushSelf};
-		BlockIterator second{m_items.begin() + diff_type(_j), m_items.end(), &pushSecondTag, &pushSelf};
+		BlockIterator first{m_items.begin() + diff_type(_i), m_items.end(), &pushOwnTag, &pushSelf};
 		BlockIterator end{m_items.end(), m_items.end()};
-
 		if (first != end && (*first).type() == Tag)
 			++first;
-		if (second != end && (*second).type() == Tag)
-			++second;
+		return _function(first, end);
+	};
 
-		return std::lexicographical_compare(first, end, second, end);
+	auto blockHash = [&](size_t _i)
+	{
+		return withBlock(_i, [](BlockIterator _it, BlockIterator const& _end) {
+			size_t seed = 0;
+			for (; _it != _end; ++_it)
+			{
+				AssemblyItem const& item = *_it;
+				boost::hash_combine(seed, item.type());
+				if (item.type() == Operation)
+					boost::hash_combine(seed, item.instruction());
+				else if (item.type() != VerbatimBytecode)
+					boost::hash_combine(seed, item.data());
+			}
+			return seed;
+		});
+	};
+
+	auto blocksEqual = [&](size_t _i, size_t _j)
+	{
+		return withBlock(_i, [&](BlockIterator const& _first, BlockIterator const& _end) {
+			return withBlock(_j, [&](BlockIterator const& _second, BlockIterator const&) {
+				return std::equal(_first, _end, _second, _end);
+			});
+		});
 	};
 
 	size_t iterations = 0;
 	for (; ; ++iterations)
 	{
-		//@todo this should probably be optimized.
-		std::set<size_t, std::function<bool(size_t, size_t)>> blocksSeen(comparator);
+		// Equal blocks have equal hashes, so a block only has to be compared
+		// to the earlier blocks with the same hash.
+		std::unordered_map<size_t, std::vector<size_t>> blocksSeen;
 		for (size_t i = 0; i < m_items.size(); ++i)
 		{
 			if (m_items.at(i).type() != Tag)
 				continue;
-			auto it = blocksSeen.find(i);
-			if (it == blocksSeen.end())
-				blocksSeen.insert(i);
+			std::vector<size_t>& bucket = blocksSeen[blockHash(i)];
+			auto it = std::find_if(bucket.begin(), bucket.end(), [&](size_t _j) { return blocksEqual(i, _j); });
+			if (it == bucket.end())
+				bucket.push_back(i);
 			else
 				m_replacedTags[m_items.at(i).data()] = m_items.at(*it).data();
 		}
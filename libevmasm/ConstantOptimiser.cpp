@@ -24,6 +24,10 @@
 #include <libevmasm/Assembly.h>
 #include <libevmasm/GasMeter.h>
 
+#include <map>
+#include <mutex>
+#include <tuple>
+
 using namespace solidity;
 using namespace solidity::evmasm;
 
@@ -186,6 +190,40 @@ AssemblyItems const& CodeCopyMethod::copyRoutine()
 	return copyRoutine;
 }
 
+ComputeMethod::ComputeMethod(Params const& _params, u256 const& _value):
+	ConstantOptimisationMethod(_params, _value)
+{
+	m_routine = cachedRepresentation(m_value);
+	assertThrow(
+		checkRepresentation(m_value, m_routine),
+		OptimizerException,
+		"Invalid constant expression created."
+	);
+}
+
+AssemblyItems ComputeMethod::cachedRepresentation(u256 const& _value)
+{
+	using Key = std::tuple<u256, langutil::EVMVersion, bool, size_t, size_t>;
+	// Bounds the memory used by long-running processes that compile many contracts.
+	static size_t const maxEntries = 0x10000;
+	static std::mutex mutex;
+	static std::map<Key, AssemblyItems> cache;
+
+	Key key{_value, m_params.evmVersion, m_params.isCreation, m_params.runs, m_params.multiplicity};
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		if (auto it = cache.find(key); it != cache.end())
+			return it->second;
+	}
+
+	// Searched without holding the lock. Concurrent searches for the same key find the same representation.
+	AssemblyItems representation = findRepresentation(_value);
+	std::lock_guard<std::mutex> lock(mutex);
+	if (cache.size() < maxEntries)
+		cache.emplace(std::move(key), representation);
+	return representation;
+}
+
 AssemblyItems ComputeMethod::findRepresentation(u256 const& _value)
 {
 	if (_value < 0x10000)
@@ -132,16 +132,7 @@ protected:
 class ComputeMethod: public ConstantOptimisationMethod
 {
 public:
-	explicit ComputeMethod(Params const& _params, u256 const& _value):
-		ConstantOptimisationMethod(_params, _value)
-	{
-		m_routine = findRepresentation(m_value);
-		assertThrow(
-			checkRepresentation(m_value, m_routine),
-			OptimizerException,
-			"Invalid constant expression created."
-		);
-	}
+	explicit ComputeMethod(Params const& _params, u256 const& _value);
 
 	bigint gasNeeded() const override { return gasNeeded(m_routine); }
 	AssemblyItems execute(Assembly&) const override
@@ -150,6 +141,10 @@ public:
 	}
 
 protected:
+	/// @returns the result of findRepresentation for @a _value, shared between all assemblies and threads.
+	/// The result only depends on the value and on the parameters, since every search starts with
+	/// the same step limit.
+	AssemblyItems cachedRepresentation(u256 const& _value);
 	/// Tries to recursively find a way to compute @a _value.
 	AssemblyItems findRepresentation(u256 const& _value);
 	/// Recomputes the value from the calculated representation and checks for correctness.
@@ -171,12 +171,10 @@ bool ExpressionClasses::knownNonZero(Id _c)
 
 u256 const* ExpressionClasses::knownConstant(Id _c)
 {
-	std::map<unsigned, Expression const*> matchGroups;
-	Pattern constant(Push);
-	constant.setMatchGroup(1, matchGroups);
-	if (!constant.matches(representative(_c), *this))
+	Expression const& expression = representative(_c);
+	if (!expression.item || expression.item->type() != Push)
 		return nullptr;
-	return &constant.d();
+	return &expression.item->data();
 }
 
 AssemblyItem const* ExpressionClasses::storeItem(AssemblyItem const& _item)
@@ -204,7 +202,9 @@ std::string ExpressionClasses::fullDAGToString(ExpressionClasses::Id _id) const
 
 ExpressionClasses::Id ExpressionClasses::tryToSimplify(Expression const& _expr)
 {
-	static Rules rules;
+	// The rules are shared by all threads, the current match is kept per thread
+	// (sub-assemblies and the chunks of an assembly can be optimised concurrently).
+	static Rules const rules;
 	assertThrow(rules.isInitialized(), OptimizerException, "Rule list not properly initialized.");
 
 	if (
@@ -123,8 +123,6 @@ private:
 	/// Rebuilds an expression from a (matched) pattern.
 	Id rebuildExpression(ExpressionTemplate const& _template);
 
-	std::vector<std::pair<Pattern, std::function<Pattern()>>> createRules() const;
-
 	/// Expression equivalence class representatives - we only store one item of an equivalence.
 	std::vector<Expression> m_representatives;
 	/// All expression ever encountered.
@@ -285,7 +285,7 @@ unsigned GasMeter::runGas(Instruction _instruction, langutil::EVMVersion _evmVer
 
 	case Tier::Special:
 	case Tier::Invalid:
-		assertThrow(false, OptimizerException, "Invalid gas tier for instruction " + instructionInfo(_instruction, _evmVersion).name);
+		assertThrow(false, OptimizerException, "Invalid gas tier for instruction " + std::string(instructionInfo(_instruction, _evmVersion).name));
 	}
 	util::unreachable();
 }
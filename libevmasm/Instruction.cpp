@@ -22,6 +22,9 @@
 
 #include <libevmasm/Instruction.h>
 
+#include <array>
+#include <utility>
+
 using namespace solidity;
 using namespace solidity::util;
 using namespace solidity::evmasm;
@@ -180,8 +183,11 @@ std::map<std::string, Instruction> const solidity::evmasm::c_instructions =
 	{ "SELFDESTRUCT", Instruction::SELFDESTRUCT }
 };
 
+namespace
+{
+
 /// @note InstructionInfo is assumed to be the same across all EVM versions except for the instruction name.
-static std::map<Instruction, InstructionInfo> const c_instructionInfo =
+constexpr std::pair<Instruction, InstructionInfo> c_instructionInfo[] =
 {   //                                                Add Args Ret SideEffects GasPriceTier
 	{Instruction::STOP,           {"STOP",            0,  0,   0,  true,       Tier::Zero}},
 	{Instruction::ADD,            {"ADD",             0,  2,   1,  false,      Tier::VeryLow}},
@@ -334,21 +340,62 @@ static std::map<Instruction, InstructionInfo> const c_instructionInfo =
 	{Instruction::SELFDESTRUCT,   {"SELFDESTRUCT",    0,  1,   0,  true,       Tier::Special}}
 };
 
-InstructionInfo solidity::evmasm::instructionInfo(Instruction _inst, langutil::EVMVersion _evmVersion)
+/// Names of the form "<INVALID_INSTRUCTION: 42>" for all opcodes.
+struct InvalidInstructionNames
 {
-	try
-	{
-		if (_inst == Instruction::PREVRANDAO && _evmVersion < langutil::EVMVersion::paris())
-			return InstructionInfo({ "DIFFICULTY", 0, 0, 1, false, Tier::Base });
-		return c_instructionInfo.at(_inst);
-	}
-	catch (...)
+	constexpr InvalidInstructionNames()
 	{
-		return InstructionInfo({"<INVALID_INSTRUCTION: " + std::to_string(static_cast<unsigned>(_inst)) + ">", 0, 0, 0, false, Tier::Invalid});
+		constexpr char prefix[] = "<INVALID_INSTRUCTION: ";
+		for (size_t opcode = 0; opcode < 256; ++opcode)
+		{
+			char* name = names[opcode];
+			size_t length = 0;
+			for (; prefix[length]; ++length)
+				name[length] = prefix[length];
+			if (opcode >= 100)
+				name[length++] = static_cast<char>('0' + opcode / 100);
+			if (opcode >= 10)
+				name[length++] = static_cast<char>('0' + opcode / 10 % 10);
+			name[length++] = static_cast<char>('0' + opcode % 10);
+			name[length] = '>';
+		}
 	}
+
+	char names[256][27] = {};
+};
+
+constexpr InvalidInstructionNames c_invalidInstructionNames;
+
+/// @returns the information on all opcodes, indexed by opcode.
+/// Before Paris, PREVRANDAO is called DIFFICULTY.
+constexpr std::array<InstructionInfo, 256> instructionInfoTable(bool _prevrandao)
+{
+	std::array<InstructionInfo, 256> table{};
+	for (size_t opcode = 0; opcode < table.size(); ++opcode)
+		table[opcode] = {c_invalidInstructionNames.names[opcode], 0, 0, 0, false, Tier::Invalid};
+	for (auto const& entry: c_instructionInfo)
+		table[static_cast<uint8_t>(entry.first)] = entry.second;
+	if (!_prevrandao)
+		table[static_cast<uint8_t>(Instruction::PREVRANDAO)].name = "DIFFICULTY";
+	return table;
+}
+
+constexpr std::array<InstructionInfo, 256> c_instructionInfoBeforeParis = instructionInfoTable(false);
+constexpr std::array<InstructionInfo, 256> c_instructionInfoSinceParis = instructionInfoTable(true);
+
+static_assert(c_instructionInfoSinceParis[static_cast<uint8_t>(Instruction::ADD)].args == 2);
+static_assert(c_instructionInfoBeforeParis[static_cast<uint8_t>(Instruction::PREVRANDAO)].name == "DIFFICULTY");
+static_assert(c_instructionInfoSinceParis[0xef].name == "<INVALID_INSTRUCTION: 239>");
+
+}
+
+InstructionInfo const& solidity::evmasm::instructionInfo(Instruction _inst, langutil::EVMVersion _evmVersion)
+{
+	auto const& table = _evmVersion < langutil::EVMVersion::paris() ? c_instructionInfoBeforeParis : c_instructionInfoSinceParis;
+	return table[static_cast<uint8_t>(_inst)];
 }
 
 bool solidity::evmasm::isValidInstruction(Instruction _inst)
 {
-	return !!c_instructionInfo.count(_inst);
+	return c_instructionInfoSinceParis[static_cast<uint8_t>(_inst)].gasPriceTier != Tier::Invalid;
 }
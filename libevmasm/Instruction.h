@@ -27,6 +27,8 @@
 #include <libsolutil/Assertions.h>
 #include <liblangutil/EVMVersion.h>
 
+#include <string_view>
+
 namespace solidity::evmasm
 {
 
@@ -308,7 +310,7 @@ enum class Tier
 /// Information structure for a particular instruction.
 struct InstructionInfo
 {
-	std::string name;   ///< The name of the instruction.
+	std::string_view name; ///< The name of the instruction.
 	int additional;     ///< Additional items required in memory for this instructions (only for PUSH).
 	int args;           ///< Number of items required on the stack for this instruction (and, for the purposes of ret, the number taken from the stack).
 	int ret;            ///< Number of items placed (back) on the stack by this instruction, assuming args items were removed.
@@ -316,8 +318,9 @@ struct InstructionInfo
 	Tier gasPriceTier;  ///< Tier for gas pricing.
 };
 
-/// Information on all the instructions.
-InstructionInfo instructionInfo(Instruction _inst, langutil::EVMVersion _evmVersion);
+/// Information on all the instructions, taken from a table indexed by opcode.
+/// Opcodes that are not instructions have the tier Tier::Invalid.
+InstructionInfo const& instructionInfo(Instruction _inst, langutil::EVMVersion _evmVersion);
 
 /// check whether instructions exists.
 bool isValidInstruction(Instruction _inst);
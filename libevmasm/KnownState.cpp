@@ -132,7 +132,7 @@ KnownState::StoreOperation KnownState::feedItem(AssemblyItem const& _item, bool
 		Instruction instruction = _item.instruction();
 		// The latest EVMVersion is used here, since the InstructionInfo is assumed to be
 		// the same across all EVM versions except for the instruction name.
-		InstructionInfo info = instructionInfo(instruction, EVMVersion());
+		InstructionInfo const& info = instructionInfo(instruction, EVMVersion());
 		if (SemanticInformation::isDupInstruction(_item))
 			setStackElement(
 				m_stackHeight + 1,
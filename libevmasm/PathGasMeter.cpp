@@ -24,15 +24,21 @@
 #include <libevmasm/KnownState.h>
 #include <libevmasm/SemanticInformation.h>
 
+#include <iterator>
+
 using namespace solidity;
 using namespace solidity::evmasm;
 
-PathGasMeter::PathGasMeter(AssemblyItems const& _items, langutil::EVMVersion _evmVersion):
-	m_items(_items), m_evmVersion(_evmVersion)
+PathGasMeter::PathGasMeter(AssemblyItems const& _items, langutil::EVMVersion _evmVersion, size_t _maxPaths):
+	m_jumpdestIndices(_items.size()), m_items(_items), m_evmVersion(_evmVersion), m_maxPaths(_maxPaths)
 {
 	for (size_t i = 0; i < m_items.size(); ++i)
+	{
 		if (m_items[i].type() == Tag)
 			m_tagPositions[m_items[i].data()] = i;
+		if (m_items[i].type() == Tag || m_items[i] == Instruction::JUMPDEST)
+			m_jumpdestIndices[i] = m_jumpdestCount++;
+	}
 }
 
 GasMeter::GasConsumption PathGasMeter::estimateMax(
@@ -40,23 +46,34 @@ GasMeter::GasConsumption PathGasMeter::estimateMax(
 	std::shared_ptr<KnownState> const& _state
 )
 {
+	m_queue.clear();
+	m_highestGasUsagePerJumpdest.clear();
+
 	auto path = std::make_unique<GasPath>();
 	path->index = _startIndex;
 	path->state = _state->copy();
+	path->visitedJumpdests.resize(m_jumpdestCount);
 	queue(std::move(path));
 
 	GasMeter::GasConsumption gas;
-	while (!m_queue.empty() && !gas.isInfinite)
+	for (size_t paths = 0; !m_queue.empty() && !gas.isInfinite; ++paths)
+	{
+		if (paths == m_maxPaths)
+			return GasMeter::GasConsumption::infinite();
 		gas = std::max(gas, handleQueueItem());
+	}
 	return gas;
 }
 
+bool PathGasMeter::worthQueueing(size_t _index, GasMeter::GasConsumption const& _gas) const
+{
+	auto highest = m_highestGasUsagePerJumpdest.find(_index);
+	return highest == m_highestGasUsagePerJumpdest.end() || !(_gas < highest->second);
+}
+
 void PathGasMeter::queue(std::unique_ptr<GasPath>&& _newPath)
 {
-	if (
-		m_highestGasUsagePerJumpdest.count(_newPath->index) &&
-		_newPath->gas < m_highestGasUsagePerJumpdest.at(_newPath->index)
-	)
+	if (!worthQueueing(_newPath->index, _newPath->gas))
 		return;
 	m_highestGasUsagePerJumpdest[_newPath->index] = _newPath->gas;
 	m_queue[_newPath->index] = std::move(_newPath);
@@ -91,9 +108,9 @@ GasMeter::GasConsumption PathGasMeter::handleQueueItem()
 		{
 			// Do not allow any backwards jump. This is quite restrictive but should work for
 			// the simplest things.
-			if (path->visitedJumpdests.count(index))
+			if (path->visitedJumpdests[m_jumpdestIndices[index]])
 				return GasMeter::GasConsumption::infinite();
-			path->visitedJumpdests.insert(index);
+			path->visitedJumpdests[m_jumpdestIndices[index]] = true;
 		}
 		else if (item == AssemblyItem(Instruction::JUMP))
 		{
@@ -118,16 +135,29 @@ GasMeter::GasConsumption PathGasMeter::handleQueueItem()
 
 		gas += meter.estimateMax(item);
 
-		for (u256 const& tag: jumpTags)
+		for (auto tag = jumpTags.begin(); tag != jumpTags.end(); ++tag)
 		{
+			auto position = m_tagPositions.find(*tag);
+			size_t newIndex = position != m_tagPositions.end() ? position->second : m_items.size();
+			// Only copy the state for paths that are actually queued.
+			if (!worthQueueing(newIndex, gas))
+				continue;
 			auto newPath = std::make_unique<GasPath>();
-			newPath->index = m_items.size();
-			if (m_tagPositions.count(tag))
-				newPath->index = m_tagPositions.at(tag);
+			newPath->index = newIndex;
 			newPath->gas = gas;
 			newPath->largestMemoryAccess = meter.largestMemoryAccess();
-			newPath->state = state->copy();
-			newPath->visitedJumpdests = path->visitedJumpdests;
+			// The last path taken at the end of a branch can take over the state and the visited
+			// jumpdests, because they are not used afterwards.
+			if (branchStops && std::next(tag) == jumpTags.end())
+			{
+				newPath->state = std::move(state);
+				newPath->visitedJumpdests = std::move(path->visitedJumpdests);
+			}
+			else
+			{
+				newPath->state = state->copy();
+				newPath->visitedJumpdests = path->visitedJumpdests;
+			}
 			queue(std::move(newPath));
 		}
 
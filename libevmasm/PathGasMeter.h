@@ -26,9 +26,10 @@
 
 #include <liblangutil/EVMVersion.h>
 
-#include <set>
-#include <vector>
+#include <limits>
+#include <map>
 #include <memory>
+#include <vector>
 
 namespace solidity::evmasm
 {
@@ -41,18 +42,28 @@ struct GasPath
 	std::shared_ptr<KnownState> state;
 	u256 largestMemoryAccess;
 	GasMeter::GasConsumption gas;
-	std::set<size_t> visitedJumpdests;
+	/// Indexed by the position of the jumpdest among all jumpdests, see PathGasMeter::m_jumpdestIndices.
+	std::vector<bool> visitedJumpdests;
 };
 
 /**
  * Computes an upper bound on the gas usage of a computation starting at a certain position in
  * a list of AssemblyItems in a given state until the computation stops.
  * Can be used to estimate the gas usage of functions on any given input.
+ *
+ * The positions of the tags are computed once, so a single instance should be used for all
+ * estimates on the same list of items.
  */
 class PathGasMeter
 {
 public:
-	explicit PathGasMeter(AssemblyItems const& _items, langutil::EVMVersion _evmVersion);
+	/// @param _maxPaths maximum number of paths that are explored per estimate. If it is exceeded,
+	/// the estimate is infinite.
+	explicit PathGasMeter(
+		AssemblyItems const& _items,
+		langutil::EVMVersion _evmVersion,
+		size_t _maxPaths = std::numeric_limits<size_t>::max()
+	);
 
 	GasMeter::GasConsumption estimateMax(size_t _startIndex, std::shared_ptr<KnownState> const& _state);
 
@@ -67,10 +78,12 @@ public:
 	}
 
 private:
-	/// Adds a new path item to the queue, but only if we do not already have
-	/// a higher gas usage at that point.
+	/// @returns true if a path reaching @a _index with @a _gas would be queued. We only queue a path
+	/// if we do not already have a higher gas usage at that point.
 	/// This is not exact as different state might influence higher gas costs at a later
 	/// point in time, but it greatly reduces computational overhead.
+	bool worthQueueing(size_t _index, GasMeter::GasConsumption const& _gas) const;
+	/// Adds a new path item to the queue, but only if worthQueueing() is true for it.
 	void queue(std::unique_ptr<GasPath>&& _newPath);
 	GasMeter::GasConsumption handleQueueItem();
 
@@ -79,8 +92,12 @@ private:
 	std::map<size_t, std::unique_ptr<GasPath>> m_queue;
 	std::map<size_t, GasMeter::GasConsumption> m_highestGasUsagePerJumpdest;
 	std::map<u256, size_t> m_tagPositions;
+	/// Position of every tag and JUMPDEST among all of them, indexed by item position.
+	std::vector<size_t> m_jumpdestIndices;
+	size_t m_jumpdestCount = 0;
 	AssemblyItems const& m_items;
 	langutil::EVMVersion m_evmVersion;
+	size_t m_maxPaths;
 };
 
 }
@@ -25,6 +25,9 @@
 #include <libevmasm/AssemblyItem.h>
 #include <libevmasm/SemanticInformation.h>
 
+#include <algorithm>
+#include <limits>
+
 using namespace solidity;
 using namespace solidity::evmasm;
 
@@ -51,6 +54,7 @@ struct FunctionParameterCount<R(Args...)>
 template <class Method>
 struct SimplePeepholeOptimizerMethod
 {
+	static constexpr size_t windowSize() { return FunctionParameterCount<decltype(Method::applySimple)>::value - 1; }
 	template <size_t... Indices>
 	static bool applyRule(
 		AssemblyItems::const_iterator _in,
@@ -62,7 +66,7 @@ struct SimplePeepholeOptimizerMethod
 	}
 	static bool apply(OptimiserState& _state)
 	{
-		static constexpr size_t WindowSize = FunctionParameterCount<decltype(Method::applySimple)>::value - 1;
+		static constexpr size_t WindowSize = windowSize();
 		if (
 			_state.i + WindowSize <= _state.items.size() &&
 			applyRule(_state.items.begin() + static_cast<ptrdiff_t>(_state.i), _state.out, std::make_index_sequence<WindowSize>{})
@@ -76,18 +80,6 @@ struct SimplePeepholeOptimizerMethod
 	}
 };
 
-struct Identity: SimplePeepholeOptimizerMethod<Identity>
-{
-	static bool applySimple(
-		AssemblyItem const& _item,
-		std::back_insert_iterator<AssemblyItems> _out
-	)
-	{
-		*_out = _item;
-		return true;
-	}
-};
-
 struct PushPop: SimplePeepholeOptimizerMethod<PushPop>
 {
 	static bool applySimple(
@@ -457,6 +449,8 @@ struct TruthyAnd: SimplePeepholeOptimizerMethod<TruthyAnd>
 /// Removes everything after a JUMP (or similar) until the next JUMPDEST.
 struct UnreachableCode
 {
+	/// Whether the method applies only depends on the first two items.
+	static constexpr size_t windowSize() { return 2; }
 	static bool apply(OptimiserState& _state)
 	{
 		auto it = _state.items.begin() + static_cast<ptrdiff_t>(_state.i);
@@ -487,16 +481,51 @@ struct UnreachableCode
 	}
 };
 
-void applyMethods(OptimiserState&)
+/// Applies the first of the given methods that matches at the current position.
+/// @returns false if none of them matches.
+template <typename... Methods>
+bool applyMethods(OptimiserState& _state, Methods...)
 {
-	assertThrow(false, OptimizerException, "Peephole optimizer failed to apply identity.");
+	return (Methods::apply(_state) || ...);
 }
 
-template <typename Method, typename... OtherMethods>
-void applyMethods(OptimiserState& _state, Method, OtherMethods... _other)
+/// Calls @a _function with all methods in the order in which they are tried.
+template <typename Function>
+constexpr auto withMethods(Function _function)
+{
+	return _function(
+		PushPop(), OpPop(), OpStop(), OpReturnRevert(), DoublePush(), DoubleSwap(), CommutativeSwap(), SwapComparison(),
+		DupSwap(), IsZeroIsZeroJumpI(), EqIsZeroJumpI(), DoubleJump(), JumpToNext(), UnreachableCode(),
+		TagConjunctions(), TruthyAnd()
+	);
+}
+
+/// Number of items that decide whether any of the methods matches at a position.
+size_t constexpr c_maxWindowSize = withMethods([](auto... _methods) {
+	return std::max({decltype(_methods)::windowSize()...});
+});
+
+size_t constexpr c_noOrigin = std::numeric_limits<size_t>::max();
+
+/// @returns true if the item at @a _position was copied unchanged in the previous call to optimise(),
+/// since none of the methods matched at its former position, and the items that follow it
+/// within the largest window are also unchanged. Then none of the methods matches again.
+bool unchangedSinceLastCall(std::vector<size_t> const& _origins, size_t _previousSize, size_t _position)
 {
-	if (!Method::apply(_state))
-		applyMethods(_state, _other...);
+	size_t const origin = _origins[_position];
+	if (origin == c_noOrigin)
+		return false;
+	for (size_t offset = 1; offset < c_maxWindowSize; ++offset)
+	{
+		bool const inside = _position + offset < _origins.size();
+		if (inside != (origin + offset < _previousSize))
+			return false;
+		if (!inside)
+			break;
+		if (_origins[_position + offset] != origin + offset)
+			return false;
+	}
+	return true;
 }
 
 size_t numberOfPops(AssemblyItems const& _items)
@@ -510,14 +539,26 @@ bool PeepholeOptimiser::optimise()
 {
 	// Avoid referencing immutables too early by using approx. counting in bytesRequired()
 	auto const approx = evmasm::Precision::Approximate;
+	bool const knownOrigins = m_origins.size() == m_items.size();
+	std::vector<size_t> origins;
+	origins.reserve(m_items.size());
+	m_optimisedItems.clear();
 	OptimiserState state {m_items, 0, back_inserter(m_optimisedItems)};
 	while (state.i < m_items.size())
-		applyMethods(
-			state,
-			PushPop(), OpPop(), OpStop(), OpReturnRevert(), DoublePush(), DoubleSwap(), CommutativeSwap(), SwapComparison(),
-			DupSwap(), IsZeroIsZeroJumpI(), EqIsZeroJumpI(), DoubleJump(), JumpToNext(), UnreachableCode(),
-			TagConjunctions(), TruthyAnd(), Identity()
-		);
+	{
+		size_t const position = state.i;
+		if (
+			!(knownOrigins && unchangedSinceLastCall(m_origins, m_previousSize, position)) &&
+			withMethods([&](auto... _methods) { return applyMethods(state, _methods...); })
+		)
+			origins.resize(m_optimisedItems.size(), c_noOrigin);
+		else
+		{
+			m_optimisedItems.push_back(m_items[position]);
+			origins.push_back(position);
+			state.i++;
+		}
+	}
 	if (m_optimisedItems.size() < m_items.size() || (
 		m_optimisedItems.size() == m_items.size() && (
 			evmasm::bytesRequired(m_optimisedItems, 3, approx) < evmasm::bytesRequired(m_items, 3, approx) ||
@@ -525,9 +566,15 @@ bool PeepholeOptimiser::optimise()
 		)
 	))
 	{
-		m_items = std::move(m_optimisedItems);
+		m_previousSize = m_items.size();
+		m_origins = std::move(origins);
+		// Keeps the memory of the previous items for the next call.
+		m_items.swap(m_optimisedItems);
 		return true;
 	}
 	else
+	{
+		m_origins.clear();
 		return false;
+	}
 }
@@ -38,17 +38,31 @@ public:
 	virtual bool apply(AssemblyItems::const_iterator _in, std::back_insert_iterator<AssemblyItems> _out);
 };
 
+/**
+ * Applies local rewrite rules to a sequence of assembly items.
+ *
+ * Every call to optimise() rewrites the whole sequence once. Items that were copied unchanged
+ * in the previous call, together with the items following them, are not matched again.
+ * Because of that, @a _items must only be changed through optimise() while it returns true.
+ */
 class PeepholeOptimiser
 {
 public:
 	explicit PeepholeOptimiser(AssemblyItems& _items): m_items(_items) {}
 	virtual ~PeepholeOptimiser() = default;
 
+	/// Rewrites the items once.
+	/// @returns true if the result is an improvement and replaced the items.
 	bool optimise();
 
 private:
 	AssemblyItems& m_items;
 	AssemblyItems m_optimisedItems;
+	/// For each item, the position it was copied from unchanged in the previous call,
+	/// since no method matched there. The maximum value for items created by a method.
+	std::vector<size_t> m_origins;
+	/// Number of items before the previous call.
+	size_t m_previousSize = 0;
 };
 
 }
@@ -39,18 +39,19 @@ using namespace solidity::langutil;
 SimplificationRule<Pattern> const* Rules::findFirstMatch(
 	Expression const& _expr,
 	ExpressionClasses const& _classes
-)
+) const
 {
-	resetMatchGroups();
+	auto& groups = matchGroups();
+	groups.clear();
 
 	assertThrow(_expr.item, OptimizerException, "");
 	for (auto const& rule: m_rules[uint8_t(_expr.item->instruction())])
 	{
-		if (rule.pattern.matches(_expr, _classes))
+		if (rule.pattern.matches(_expr, _classes, groups))
 			if (!rule.feasible || rule.feasible())
 				return &rule;
 
-		resetMatchGroups();
+		groups.clear();
 	}
 	return nullptr;
 }
@@ -60,6 +61,12 @@ bool Rules::isInitialized() const
 	return !m_rules[uint8_t(Instruction::ADD)].empty();
 }
 
+std::map<unsigned, Rules::Expression const*>& Rules::matchGroups()
+{
+	thread_local std::map<unsigned, Expression const*> matchGroups;
+	return matchGroups;
+}
+
 void Rules::addRules(std::vector<SimplificationRule<Pattern>> const& _rules)
 {
 	for (auto const& r: _rules)
@@ -83,13 +90,13 @@ Rules::Rules()
 	Pattern X;
 	Pattern Y;
 	Pattern Z;
-	A.setMatchGroup(1, m_matchGroups);
-	B.setMatchGroup(2, m_matchGroups);
-	C.setMatchGroup(3, m_matchGroups);
-	W.setMatchGroup(4, m_matchGroups);
-	X.setMatchGroup(5, m_matchGroups);
-	Y.setMatchGroup(6, m_matchGroups);
-	Z.setMatchGroup(7, m_matchGroups);
+	A.setMatchGroup(1);
+	B.setMatchGroup(2);
+	C.setMatchGroup(3);
+	W.setMatchGroup(4);
+	X.setMatchGroup(5);
+	Y.setMatchGroup(6);
+	Z.setMatchGroup(7);
 
 	addRules(simplificationRuleList(std::nullopt, A, B, C, W, X, Y, Z));
 	assertThrow(isInitialized(), OptimizerException, "Rule list not properly initialized.");
@@ -102,26 +109,34 @@ Pattern::Pattern(Instruction _instruction, std::initializer_list<Pattern> _argum
 {
 }
 
-void Pattern::setMatchGroup(unsigned _group, std::map<unsigned, Expression const*>& _matchGroups)
+void Pattern::setMatchGroup(unsigned _group)
 {
 	m_matchGroup = _group;
-	m_matchGroups = &_matchGroups;
 }
 
 bool Pattern::matches(Expression const& _expr, ExpressionClasses const& _classes) const
+{
+	return matches(_expr, _classes, Rules::matchGroups());
+}
+
+bool Pattern::matches(
+	Expression const& _expr,
+	ExpressionClasses const& _classes,
+	std::map<unsigned, Expression const*>& _matchGroups
+) const
 {
 	if (!matchesBaseItem(_expr.item))
 		return false;
 	if (m_matchGroup)
 	{
-		if (!m_matchGroups->count(m_matchGroup))
-			(*m_matchGroups)[m_matchGroup] = &_expr;
-		else if ((*m_matchGroups)[m_matchGroup]->id != _expr.id)
+		if (!_matchGroups.count(m_matchGroup))
+			_matchGroups[m_matchGroup] = &_expr;
+		else if (_matchGroups[m_matchGroup]->id != _expr.id)
 			return false;
 	}
 	assertThrow(m_arguments.size() == 0 || _expr.arguments.size() == m_arguments.size(), OptimizerException, "");
 	for (size_t i = 0; i < m_arguments.size(); ++i)
-		if (!m_arguments[i].matches(_classes.representative(_expr.arguments[i]), _classes))
+		if (!m_arguments[i].matches(_classes.representative(_expr.arguments[i]), _classes, _matchGroups))
 			return false;
 	return true;
 }
@@ -188,9 +203,9 @@ bool Pattern::matchesBaseItem(AssemblyItem const* _item) const
 Pattern::Expression const& Pattern::matchGroupValue() const
 {
 	assertThrow(m_matchGroup > 0, OptimizerException, "");
-	assertThrow(!!m_matchGroups, OptimizerException, "");
-	assertThrow((*m_matchGroups)[m_matchGroup], OptimizerException, "");
-	return *(*m_matchGroups)[m_matchGroup];
+	auto& matchGroups = Rules::matchGroups();
+	assertThrow(matchGroups[m_matchGroup], OptimizerException, "");
+	return *matchGroups[m_matchGroup];
 }
 
 u256 const& Pattern::data() const
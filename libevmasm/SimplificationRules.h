@@ -44,6 +44,7 @@ class Pattern;
 
 /**
  * Container for all simplification rules.
+ * The rules are not modified after construction, so they can be shared by several threads.
  */
 class Rules
 {
@@ -57,23 +58,24 @@ public:
 	Rules();
 
 	/// @returns a pointer to the first matching pattern and sets the match
-	/// groups accordingly.
+	/// groups of the calling thread accordingly.
 	SimplificationRule<Pattern> const* findFirstMatch(
 		Expression const& _expr,
 		ExpressionClasses const& _classes
-	);
+	) const;
 
 	/// Checks whether the rulelist is non-empty. This is usually enforced
 	/// by the constructor, but we had some issues with static initialization.
 	bool isInitialized() const;
 
+	/// @returns the expressions matched by the match groups in the calling thread.
+	static std::map<unsigned, Expression const*>& matchGroups();
+
 private:
 	void addRules(std::vector<SimplificationRule<Pattern>> const& _rules);
 	void addRule(SimplificationRule<Pattern> const& _rule);
 
-	void resetMatchGroups() { m_matchGroups.clear(); }
 
-	std::map<unsigned, Expression const*> m_matchGroups;
 	/// Pattern to match, replacement to be applied and flag indicating whether
 	/// the replacement might remove some elements (except constants).
 	std::vector<SimplificationRule<Pattern>> m_rules[256];
@@ -107,9 +109,16 @@ public:
 	/// Sets this pattern to be part of the match group with the identifier @a _group.
 	/// Inside one rule, all patterns in the same match group have to match expressions from the
 	/// same expression equivalence class.
-	void setMatchGroup(unsigned _group, std::map<unsigned, Expression const*>& _matchGroups);
+	void setMatchGroup(unsigned _group);
 	unsigned matchGroup() const { return m_matchGroup; }
 	bool matches(Expression const& _expr, ExpressionClasses const& _classes) const;
+	/// Matches @a _expr and stores the matched expressions in @a _matchGroups,
+	/// which has to be Rules::matchGroups() for them to be retrieved later.
+	bool matches(
+		Expression const& _expr,
+		ExpressionClasses const& _classes,
+		std::map<unsigned, Expression const*>& _matchGroups
+	) const;
 
 	AssemblyItem toAssemblyItem(langutil::DebugData::ConstPtr _debugData) const;
 	std::vector<Pattern> arguments() const { return m_arguments; }
@@ -139,7 +148,6 @@ private:
 	std::shared_ptr<u256> m_data; ///< Only valid if m_type is not Operation
 	std::vector<Pattern> m_arguments;
 	unsigned m_matchGroup = 0;
-	std::map<unsigned, Expression const*>* m_matchGroups = nullptr;
 };
 
 /**
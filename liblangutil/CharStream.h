@@ -50,9 +50,11 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstdint>
 #include <optional>
 #include <string>
+#include <string_view>
 #include <tuple>
 #include <utility>
 
@@ -84,6 +86,8 @@ public:
 	bool isImportedFromAST() const { return m_importedFromAST; }
 
 	char get(size_t _charsForward = 0) const { return m_source[m_position + _charsForward]; }
+	/// @returns the characters from the current position to the end of the input.
+	std::string_view upcoming() const { return std::string_view(m_source).substr(std::min(m_position, m_source.size())); }
 	char advanceAndGet(size_t _chars = 1);
 	/// Sets scanner position to @ _amount characters backwards in source text.
 	/// @returns The character of the current location after update is returned.
@@ -56,6 +56,7 @@
 
 #include <boost/algorithm/string/classification.hpp>
 
+#include <cstring>
 #include <optional>
 #include <string_view>
 #include <tuple>
@@ -306,14 +307,42 @@ static ScannerError validateBiDiMarkup(CharStream& _stream, size_t _startPositio
 
 }
 
+namespace
+{
+
+/// @returns the length of the longest prefix of @a _text that consists of whole blocks of eight
+/// printable ASCII characters. Tests one block at a time instead of every character on its own.
+size_t printableASCIIBlocks(std::string_view _text)
+{
+	uint64_t constexpr ones = 0x0101010101010101;
+	uint64_t constexpr highBits = 0x8080808080808080;
+	size_t length = 0;
+	for (; length + 8 <= _text.size(); length += 8)
+	{
+		uint64_t block = 0;
+		std::memcpy(&block, _text.data() + length, 8);
+		// A byte below 0x20 borrows when subtracting 0x20 and sets its highest bit, unless a lower
+		// byte already did. Non-ASCII bytes have the highest bit set themselves.
+		if (((block - ones * 0x20) | block) & highBits)
+			break;
+	}
+	return length;
+}
+
+}
+
 Token Scanner::skipSingleLineComment()
 {
 	// Line terminator is not part of the comment. If it is a
 	// non-ascii line terminator, it will result in a parser error.
 	size_t startPosition = m_source.position();
-	while (!isUnicodeLinebreak())
-		if (!advance())
+	while (true)
+	{
+		// Line terminators are control characters or start with a non-ASCII byte.
+		m_char = m_source.advanceAndGet(printableASCIIBlocks(m_source.upcoming()));
+		if (isUnicodeLinebreak() || !advance())
 			break;
+	}
 
 	ScannerError unicodeDirectionError = validateBiDiMarkup(m_source, startPosition);
 	if (unicodeDirectionError != ScannerError::NoError)
@@ -391,26 +420,23 @@ size_t Scanner::scanSingleLineDocComment()
 Token Scanner::skipMultiLineComment()
 {
 	size_t startPosition = m_source.position();
-	while (!isSourcePastEndOfInput())
+	size_t terminator = m_source.upcoming().find("*/");
+	if (terminator == std::string_view::npos)
 	{
-		char prevChar = m_char;
-		advance();
+		// Unterminated multi-line comment.
+		m_char = m_source.advanceAndGet(m_source.upcoming().size());
+		return setError(ScannerError::IllegalCommentTerminator);
+	}
 
-		// If we have reached the end of the multi-line comment, we
-		// consume the '/' and insert a whitespace. This way all
-		// multi-line comments are treated as whitespace.
-		if (prevChar == '*' && m_char == '/')
-		{
-			ScannerError unicodeDirectionError = validateBiDiMarkup(m_source, startPosition);
-			if (unicodeDirectionError != ScannerError::NoError)
-				return setError(unicodeDirectionError);
+	// We consume the '/' and insert a whitespace. This way all
+	// multi-line comments are treated as whitespace.
+	m_char = m_source.setPosition(startPosition + terminator + 1);
+	ScannerError unicodeDirectionError = validateBiDiMarkup(m_source, startPosition);
+	if (unicodeDirectionError != ScannerError::NoError)
+		return setError(unicodeDirectionError);
 
-			m_char = ' ';
-			return Token::Whitespace;
-		}
-	}
-	// Unterminated multi-line comment.
-	return setError(ScannerError::IllegalCommentTerminator);
+	m_char = ' ';
+	return Token::Whitespace;
 }
 
 Token Scanner::scanMultiLineDocComment()
@@ -909,9 +935,7 @@ void Scanner::scanDecimalDigits()
 		return;
 
 	// May continue with decimal digit or underscore for grouping.
-	do
-		addLiteralCharAndAdvance();
-	while (!m_source.isPastEndOfInput() && (isDecimalDigit(m_char) || m_char == '_'));
+	addLiteralRun([](char _char) { return isDecimalDigit(_char) || _char == '_'; });
 
 	// Defer further validation of underscore to SyntaxChecker.
 }
@@ -944,8 +968,8 @@ Token Scanner::scanNumber(char _charSeen)
 				if (!isHexDigit(m_char))
 					return setError(ScannerError::IllegalHexDigit); // we must have at least one hex digit after 'x'
 
-				while (isHexDigit(m_char) || m_char == '_') // We keep the underscores for later validation
-					addLiteralCharAndAdvance();
+				// We keep the underscores for later validation
+				addLiteralRun([](char _char) { return isHexDigit(_char) || _char == '_'; });
 			}
 			else if (isDecimalDigit(m_char))
 				// We do not allow octal numbers
@@ -1014,10 +1038,8 @@ std::tuple<Token, unsigned, unsigned> Scanner::scanIdentifierOrKeyword()
 {
 	solAssert(isIdentifierStart(m_char), "");
 	LiteralScope literal(this, LITERAL_TYPE_STRING);
-	addLiteralCharAndAdvance();
-	// Scan the rest of the identifier characters.
-	while (isIdentifierPart(m_char) || (m_char == '.' && m_kind == ScannerKind::Yul))
-		addLiteralCharAndAdvance();
+	bool const dotAllowed = m_kind == ScannerKind::Yul;
+	addLiteralRun([&](char _char) { return isIdentifierPart(_char) || (_char == '.' && dotAllowed); });
 	literal.complete();
 
 	auto const token = TokenTraits::fromIdentifierOrKeyword(m_tokens[NextNext].literal);
@@ -200,6 +200,18 @@ private:
 	inline void addLiteralChar(char c) { m_tokens[NextNext].literal.push_back(c); }
 	inline void addCommentLiteralChar(char c) { m_skippedComments[NextNext].literal.push_back(c); }
 	inline void addLiteralCharAndAdvance() { addLiteralChar(m_char); advance(); }
+	/// Adds the current character and all following ones for which @a _predicate is true
+	/// to the literal at once and advances behind them.
+	template <class Predicate>
+	void addLiteralRun(Predicate _predicate)
+	{
+		std::string_view upcoming = m_source.upcoming();
+		size_t length = 1;
+		while (length < upcoming.size() && _predicate(upcoming[length]))
+			++length;
+		m_tokens[NextNext].literal.append(upcoming.substr(0, length));
+		m_char = m_source.advanceAndGet(length);
+	}
 	void addUnicodeAsUTF8(unsigned codepoint);
 	///@}
 
@@ -85,11 +85,12 @@ void CHCSmtLib2Interface::registerRelation(Expression const& _expr)
 
 void CHCSmtLib2Interface::addRule(Expression const& _expr, std::string const& /*_name*/)
 {
-	write(
-		"(assert\n(forall " + forall() + "\n" +
-		m_smtlib2->toSExpr(_expr) +
-		"))\n\n"
-	);
+	// Serialised directly into the accumulated output, since the rules make up most of a query.
+	m_accumulatedOutput += "(assert\n(forall ";
+	m_accumulatedOutput += forall();
+	m_accumulatedOutput += "\n";
+	m_smtlib2->toSExpr(_expr, m_accumulatedOutput);
+	m_accumulatedOutput += "))\n\n\n";
 }
 
 std::tuple<CheckResult, Expression, CHCSolverInterface::CexGraph> CHCSmtLib2Interface::query(Expression const& _block)
@@ -175,7 +176,8 @@ void CHCSmtLib2Interface::declareFunction(std::string const& _name, SortPointer
 
 void CHCSmtLib2Interface::write(std::string _data)
 {
-	m_accumulatedOutput += std::move(_data) + "\n";
+	m_accumulatedOutput += _data;
+	m_accumulatedOutput += '\n';
 }
 
 std::string CHCSmtLib2Interface::querySolver(std::string const& _input)
@@ -198,15 +200,19 @@ std::string CHCSmtLib2Interface::querySolver(std::string const& _input)
 
 std::string CHCSmtLib2Interface::dumpQuery(Expression const& _expr)
 {
-	std::stringstream s;
-
-	s
-		<< createHeaderAndDeclarations()
-		<< m_accumulatedOutput << std::endl
-		<< createQueryAssertion(_expr.name) << std::endl
-		<< "(check-sat)" << std::endl;
-
-	return s.str();
+	std::string header = createHeaderAndDeclarations();
+	std::string assertion = createQueryAssertion(_expr.name);
+	std::string const checkSat = "(check-sat)\n";
+
+	std::string query;
+	query.reserve(header.size() + m_accumulatedOutput.size() + assertion.size() + checkSat.size() + 2);
+	query += header;
+	query += m_accumulatedOutput;
+	query += '\n';
+	query += assertion;
+	query += '\n';
+	query += checkSat;
+	return query;
 }
 
 std::string CHCSmtLib2Interface::createHeaderAndDeclarations() {
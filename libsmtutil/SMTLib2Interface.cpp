@@ -20,15 +20,17 @@
 
 #include <libsolutil/Keccak256.h>
 
-#include <boost/algorithm/string/join.hpp>
 #include <boost/algorithm/string/predicate.hpp>
 
 #include <range/v3/algorithm/find_if.hpp>
 
+#include <algorithm>
 #include <array>
+#include <functional>
 #include <fstream>
 #include <iostream>
 #include <memory>
+#include <set>
 #include <stdexcept>
 #include <string>
 #include <utility>
@@ -111,15 +113,17 @@ void SMTLib2Interface::declareFunction(std::string const& _name, SortPointer con
 
 void SMTLib2Interface::addAssertion(Expression const& _expr)
 {
-	write("(assert " + toSExpr(_expr) + ")");
+	// Serialised into a separate buffer, since sort declarations
+	// created while serialising have to be written before the assertion.
+	std::string assertion = "(assert ";
+	toSExpr(_expr, assertion);
+	assertion += ")";
+	write(std::move(assertion));
 }
 
 std::pair<CheckResult, std::vector<std::string>> SMTLib2Interface::check(std::vector<Expression> const& _expressionsToEvaluate)
 {
-	std::string response = querySolver(
-		boost::algorithm::join(m_accumulatedOutput, "\n") +
-		checkSatAndGetValuesCommand(_expressionsToEvaluate)
-	);
+	std::string response = querySolver(dumpQuery(_expressionsToEvaluate));
 
 	CheckResult result;
 	// TODO proper parsing
@@ -139,53 +143,168 @@ std::pair<CheckResult, std::vector<std::string>> SMTLib2Interface::check(std::ve
 }
 
 std::string SMTLib2Interface::toSExpr(Expression const& _expr)
+{
+	std::string sexpr;
+	toSExpr(_expr, sexpr);
+	return sexpr;
+}
+
+void SMTLib2Interface::toSExpr(Expression const& _expr, std::string& _output)
+{
+	if (m_letBindSharedSubterms)
+		toSExprWithLetBindings(_expr, _output);
+	else
+		toSExprInternal(_expr, _output);
+}
+
+void SMTLib2Interface::toSExprWithLetBindings(Expression const& _expr, std::string& _output)
+{
+	smtAssert(m_letVariables.empty());
+	ScopeGuard clearLetVariables([&]() { m_letVariables.clear(); });
+
+	// Counts the references to each compound subterm and lists the subterms in post-order,
+	// so that the subterms of a shared subterm are bound before the subterm itself.
+	std::unordered_map<void const*, std::pair<Expression const*, size_t>> references;
+	std::vector<Expression const*> subterms;
+	std::set<std::string> names;
+	std::function<void(Expression const&)> visit = [&](Expression const& _subterm) {
+		names.insert(_subterm.name);
+		if (_subterm.arguments.empty())
+			return;
+		auto& [first, count] = references.try_emplace(_subterm.arguments.id(), &_subterm, 0).first->second;
+		if (first->name != _subterm.name || first->sort != _subterm.sort)
+			return;
+		if (count++ > 0)
+			return;
+		for (auto const& argument: _subterm.arguments)
+			visit(argument);
+		subterms.push_back(&_subterm);
+	};
+	visit(_expr);
+
+	// Shared subterms that only refer to variables bound at lower depths
+	// are bound in parallel by the same let.
+	std::vector<std::vector<std::pair<std::string, std::string>>> bindings;
+	size_t nextIndex = 0;
+	for (Expression const* subterm: subterms)
+	{
+		if (references.at(subterm->arguments.id()).second < 2)
+			continue;
+
+		std::string name;
+		do
+			name = "_let_" + std::to_string(nextIndex++);
+		while (names.count(name) || m_variables.count(name));
+
+		m_letDepth = 0;
+		std::string definition;
+		toSExprInternal(*subterm, definition);
+		size_t depth = m_letDepth;
+		if (bindings.size() <= depth)
+			bindings.resize(depth + 1);
+		bindings[depth].emplace_back(name, std::move(definition));
+		m_letVariables.emplace(subterm->arguments.id(), LetVariable{subterm, std::move(name), depth + 1});
+	}
+
+	for (auto const& level: bindings)
+	{
+		_output += "(let (";
+		for (size_t i = 0; i < level.size(); ++i)
+		{
+			if (i > 0)
+				_output += " ";
+			_output += "(" + level[i].first + " ";
+			_output += level[i].second;
+			_output += ")";
+		}
+		_output += ") ";
+	}
+	toSExprInternal(_expr, _output);
+	_output.append(bindings.size(), ')');
+}
+
+void SMTLib2Interface::toSExprInternal(Expression const& _expr, std::string& _output)
 {
 	if (_expr.arguments.empty())
-		return _expr.name;
+	{
+		_output += _expr.name;
+		return;
+	}
+
+	if (!m_letVariables.empty())
+		if (
+			auto it = m_letVariables.find(_expr.arguments.id());
+			it != m_letVariables.end() &&
+			it->second.expression->name == _expr.name &&
+			it->second.expression->sort == _expr.sort
+		)
+		{
+			_output += it->second.name;
+			m_letDepth = std::max(m_letDepth, it->second.depth);
+			return;
+		}
 
-	std::string sexpr = "(";
 	if (_expr.name == "int2bv")
 	{
 		size_t size = std::stoul(_expr.arguments[1].name);
-		auto arg = toSExpr(_expr.arguments.front());
-		auto int2bv = "(_ int2bv " + std::to_string(size) + ")";
+		// The argument occurs three times, so it is only serialised once.
+		std::string arg;
+		toSExprInternal(_expr.arguments.front(), arg);
+		std::string int2bv = "(_ int2bv " + std::to_string(size) + ")";
 		// Some solvers treat all BVs as unsigned, so we need to manually apply 2's complement if needed.
-		sexpr += std::string("ite ") +
-			"(>= " + arg + " 0) " +
-			"(" + int2bv + " " + arg + ") " +
-			"(bvneg (" + int2bv + " (- " + arg + ")))";
+		_output += "(ite (>= ";
+		_output += arg;
+		_output += " 0) (";
+		_output += int2bv;
+		_output += " ";
+		_output += arg;
+		_output += ") (bvneg (";
+		_output += int2bv;
+		_output += " (- ";
+		_output += arg;
+		_output += "))))";
+		return;
 	}
 	else if (_expr.name == "bv2int")
 	{
 		auto intSort = std::dynamic_pointer_cast<IntSort>(_expr.sort);
 		smtAssert(intSort, "");
 
-		auto arg = toSExpr(_expr.arguments.front());
-		auto nat = "(bv2nat " + arg + ")";
-
 		if (!intSort->isSigned)
-			return nat;
+		{
+			_output += "(bv2nat ";
+			toSExprInternal(_expr.arguments.front(), _output);
+			_output += ")";
+			return;
+		}
 
 		auto bvSort = std::dynamic_pointer_cast<BitVectorSort>(_expr.arguments.front().sort);
 		smtAssert(bvSort, "");
-		auto size = std::to_string(bvSort->size);
 		auto pos = std::to_string(bvSort->size - 1);
+		std::string arg;
+		toSExprInternal(_expr.arguments.front(), arg);
 
 		// Some solvers treat all BVs as unsigned, so we need to manually apply 2's complement if needed.
-		sexpr += std::string("ite ") +
-			"(= ((_ extract " + pos + " " + pos + ")" + arg + ") #b0) " +
-			nat + " " +
-			"(- (bv2nat (bvneg " + arg + ")))";
+		_output += "(ite (= ((_ extract " + pos + " " + pos + ")";
+		_output += arg;
+		_output += ") #b0) (bv2nat ";
+		_output += arg;
+		_output += ") (- (bv2nat (bvneg ";
+		_output += arg;
+		_output += "))))";
+		return;
 	}
-	else if (_expr.name == "const_array")
+
+	_output += "(";
+	if (_expr.name == "const_array")
 	{
 		smtAssert(_expr.arguments.size() == 2, "");
 		auto sortSort = std::dynamic_pointer_cast<SortSort>(_expr.arguments.at(0).sort);
 		smtAssert(sortSort, "");
 		auto arraySort = std::dynamic_pointer_cast<ArraySort>(sortSort->inner);
 		smtAssert(arraySort, "");
-		sexpr += "(as const " + toSmtLibSort(arraySort) + ") ";
-		sexpr += toSExpr(_expr.arguments.at(1));
+		_output += "(as const " + toSmtLibSort(arraySort) + ") ";
+		toSExprInternal(_expr.arguments.at(1), _output);
 	}
 	else if (_expr.name == "tuple_get")
 	{
@@ -193,24 +312,30 @@ std::string SMTLib2Interface::toSExpr(Expression const& _expr)
 		auto tupleSort = std::dynamic_pointer_cast<TupleSort>(_expr.arguments.at(0).sort);
 		size_t index = std::stoul(_expr.arguments.at(1).name);
 		smtAssert(index < tupleSort->members.size(), "");
-		sexpr += "|" + tupleSort->members.at(index) + "| " + toSExpr(_expr.arguments.at(0));
+		_output += "|" + tupleSort->members.at(index) + "| ";
+		toSExprInternal(_expr.arguments.at(0), _output);
 	}
 	else if (_expr.name == "tuple_constructor")
 	{
 		auto tupleSort = std::dynamic_pointer_cast<TupleSort>(_expr.sort);
 		smtAssert(tupleSort, "");
-		sexpr += "|" + tupleSort->name + "|";
+		_output += "|" + tupleSort->name + "|";
 		for (auto const& arg: _expr.arguments)
-			sexpr += " " + toSExpr(arg);
+		{
+			_output += " ";
+			toSExprInternal(arg, _output);
+		}
 	}
 	else
 	{
-		sexpr += _expr.name;
+		_output += _expr.name;
 		for (auto const& arg: _expr.arguments)
-			sexpr += " " + toSExpr(arg);
+		{
+			_output += " ";
+			toSExprInternal(arg, _output);
+		}
 	}
-	sexpr += ")";
-	return sexpr;
+	_output += ")";
 }
 
 std::string SMTLib2Interface::toSmtLibSort(solidity::smtutil::SortPointer _sort)
@@ -271,7 +396,8 @@ std::string SMTLib2Interface::toSmtLibSort(std::vector<SortPointer> const& _sort
 void SMTLib2Interface::write(std::string _data)
 {
 	smtAssert(!m_accumulatedOutput.empty(), "");
-	m_accumulatedOutput.back() += std::move(_data) + "\n";
+	m_accumulatedOutput.back() += _data;
+	m_accumulatedOutput.back() += '\n';
 }
 
 std::string SMTLib2Interface::checkSatAndGetValuesCommand(std::vector<Expression> const& _expressionsToEvaluate)
@@ -287,7 +413,9 @@ std::string SMTLib2Interface::checkSatAndGetValuesCommand(std::vector<Expression
 			auto const& e = _expressionsToEvaluate.at(i);
 			smtAssert(e.sort->kind == Kind::Int || e.sort->kind == Kind::Bool, "Invalid sort for expression to evaluate.");
 			command += "(declare-const |EVALEXPR_" + std::to_string(i) + "| " + (e.sort->kind == Kind::Int ? "Int" : "Bool") + ")\n";
-			command += "(assert (= |EVALEXPR_" + std::to_string(i) + "| " + toSExpr(e) + "))\n";
+			command += "(assert (= |EVALEXPR_" + std::to_string(i) + "| ";
+			toSExpr(e, command);
+			command += "))\n";
 		}
 		command += "(check-sat)\n";
 		command += "(get-value (";
@@ -333,6 +461,19 @@ std::string SMTLib2Interface::querySolver(std::string const& _input)
 
 std::string SMTLib2Interface::dumpQuery(std::vector<Expression> const& _expressionsToEvaluate)
 {
-	return boost::algorithm::join(m_accumulatedOutput, "\n") +
-		checkSatAndGetValuesCommand(_expressionsToEvaluate);
+	std::string command = checkSatAndGetValuesCommand(_expressionsToEvaluate);
+	// Assembled in a single allocation, since the accumulated assertions can be large.
+	size_t size = command.size() + m_accumulatedOutput.size();
+	for (std::string const& output: m_accumulatedOutput)
+		size += output.size();
+	std::string query;
+	query.reserve(size);
+	for (size_t i = 0; i < m_accumulatedOutput.size(); ++i)
+	{
+		if (i > 0)
+			query += '\n';
+		query += m_accumulatedOutput[i];
+	}
+	query += command;
+	return query;
 }
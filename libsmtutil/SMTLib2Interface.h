@@ -29,6 +29,7 @@
 #include <map>
 #include <set>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace solidity::smtutil
@@ -61,10 +62,18 @@ public:
 
 	// Used by CHCSmtLib2Interface
 	std::string toSExpr(Expression const& _expr);
+	/// Appends the SMT-LIB2 representation of @a _expr to @a _output,
+	/// so that nested expressions are serialised into a single buffer.
+	void toSExpr(Expression const& _expr, std::string& _output);
+	/// Enables binding the subterms that occur more than once in a serialised expression
+	/// to let variables, so that each of them is serialised only once.
+	/// This changes the text of the queries, which the query responses are keyed by,
+	/// so it is only meant for solvers that are called directly.
+	void setLetBindSharedSubterms(bool _enabled) { m_letBindSharedSubterms = _enabled; }
 	std::string toSmtLibSort(SortPointer _sort);
 	std::string toSmtLibSort(std::vector<SortPointer> const& _sort);
 
-	std::map<std::string, SortPointer> variables() { return m_variables; }
+	std::map<std::string, SortPointer> const& variables() const { return m_variables; }
 
 	std::vector<std::pair<std::string, std::string>> const& userSorts() const { return m_userSorts; }
 	std::map<SortPointer, std::string> const& sortNames() const { return m_sortNames; }
@@ -86,6 +95,10 @@ protected:
 
 	std::string toSmtLibSortInternal(SortPointer _sort);
 
+	/// Serialises @a _expr, preceded by let bindings of its shared subterms.
+	void toSExprWithLetBindings(Expression const& _expr, std::string& _output);
+	void toSExprInternal(Expression const& _expr, std::string& _output);
+
 	std::vector<std::string> m_accumulatedOutput;
 	std::map<std::string, SortPointer> m_variables;
 
@@ -103,6 +116,21 @@ protected:
 	std::vector<std::string> m_unhandledQueries;
 
 	frontend::ReadCallback::Callback m_smtCallback;
+
+	struct LetVariable
+	{
+		Expression const* expression;
+		std::string name;
+		/// The number of nested let bindings needed to define the variable.
+		size_t depth;
+	};
+
+	bool m_letBindSharedSubterms = false;
+	/// The let variables bound while serialising an expression,
+	/// keyed by the identifier of the arguments of the subterm they stand for.
+	std::unordered_map<void const*, LetVariable> m_letVariables;
+	/// The maximal depth of the let variables referenced by the subterm being serialised.
+	size_t m_letDepth = 0;
 };
 
 }
@@ -119,6 +119,48 @@ class Expression
 {
 	friend class SolverInterface;
 public:
+	/// Immutable list of the arguments of an expression.
+	/// Copies share the elements, so that copying an expression takes constant time
+	/// instead of copying the whole term, and solver interfaces can use the identity of
+	/// the shared elements to translate a subterm only once.
+	class Arguments
+	{
+	public:
+		Arguments() = default;
+		Arguments(std::vector<Expression> _arguments):
+			m_arguments(
+				_arguments.empty() ?
+				nullptr :
+				std::make_shared<std::vector<Expression> const>(std::move(_arguments))
+			)
+		{}
+
+		operator std::vector<Expression> const&() const { return m_arguments ? *m_arguments : noArguments(); }
+
+		std::vector<Expression>::const_iterator begin() const { return elements().begin(); }
+		std::vector<Expression>::const_iterator end() const { return elements().end(); }
+		size_t size() const { return m_arguments ? m_arguments->size() : 0; }
+		bool empty() const { return !m_arguments; }
+		Expression const& at(size_t _index) const { return elements().at(_index); }
+		Expression const& operator[](size_t _index) const { return elements()[_index]; }
+		Expression const& front() const { return elements().front(); }
+		Expression const& back() const { return elements().back(); }
+
+		/// @returns an identifier of the elements that is the same for all copies of this list
+		/// and unique among all lists that are alive, or nullptr if the list is empty.
+		void const* id() const { return m_arguments.get(); }
+
+	private:
+		std::vector<Expression> const& elements() const { return *this; }
+		static std::vector<Expression> const& noArguments()
+		{
+			static std::vector<Expression> const empty;
+			return empty;
+		}
+
+		std::shared_ptr<std::vector<Expression> const> m_arguments;
+	};
+
 	explicit Expression(bool _v): Expression(_v ? "true" : "false", Kind::Bool) {}
 	explicit Expression(std::shared_ptr<SortSort> _sort, std::string _name = ""): Expression(std::move(_name), {}, _sort) {}
 	explicit Expression(std::string _name, std::vector<Expression> _arguments, SortPointer _sort):
@@ -485,7 +527,7 @@ public:
 	}
 
 	std::string name;
-	std::vector<Expression> arguments;
+	Arguments arguments;
 	SortPointer sort;
 
 private:
@@ -18,6 +18,7 @@
 
 #include <libsmtutil/Z3CHCInterface.h>
 
+#include <libsolutil/Common.h>
 #include <libsolutil/CommonIO.h>
 
 #include <set>
@@ -79,6 +80,8 @@ void Z3CHCInterface::addRule(Expression const& _expr, std::string const& _name)
 std::tuple<CheckResult, Expression, CHCSolverInterface::CexGraph> Z3CHCInterface::query(Expression const& _expr)
 {
 	CheckResult result;
+	// The translations of the rules and of the query are only reused within this query.
+	ScopeGuard clearTranslations([&]() { m_z3Interface->clearTranslations(); });
 	try
 	{
 		z3::expr z3Expr = m_z3Interface->toZ3Expr(_expr);
@@ -38,6 +38,16 @@ bool Z3Interface::available()
 #endif
 }
 
+std::string Z3Interface::version()
+{
+	unsigned major = 0;
+	unsigned minor = 0;
+	unsigned build = 0;
+	unsigned rev = 0;
+	Z3_get_version(&major, &minor, &build, &rev);
+	return std::to_string(major) + "." + std::to_string(minor) + "." + std::to_string(build) + "." + std::to_string(rev);
+}
+
 Z3Interface::Z3Interface(std::optional<unsigned> _queryTimeout):
 	SolverInterface(_queryTimeout),
 	m_solver(m_context)
@@ -55,6 +65,7 @@ void Z3Interface::reset()
 {
 	m_constants.clear();
 	m_functions.clear();
+	clearTranslations();
 	m_solver.reset();
 }
 
@@ -66,6 +77,7 @@ void Z3Interface::push()
 void Z3Interface::pop()
 {
 	m_solver.pop();
+	clearTranslations();
 }
 
 void Z3Interface::declareVariable(std::string const& _name, SortPointer const& _sort)
@@ -74,7 +86,13 @@ void Z3Interface::declareVariable(std::string const& _name, SortPointer const& _
 	if (_sort->kind == Kind::Function)
 		declareFunction(_name, *_sort);
 	else if (m_constants.count(_name))
-		m_constants.at(_name) = m_context.constant(_name.c_str(), z3Sort(*_sort));
+	{
+		z3::expr constant = m_context.constant(_name.c_str(), z3Sort(*_sort));
+		// Translations that refer to the previous declaration are outdated if the sort changed.
+		if (!z3::eq(constant, m_constants.at(_name)))
+			m_translations.clear();
+		m_constants.at(_name) = constant;
+	}
 	else
 		m_constants.emplace(_name, m_context.constant(_name.c_str(), z3Sort(*_sort)));
 }
@@ -84,7 +102,12 @@ void Z3Interface::declareFunction(std::string const& _name, Sort const& _sort)
 	smtAssert(_sort.kind == Kind::Function, "");
 	FunctionSort fSort = dynamic_cast<FunctionSort const&>(_sort);
 	if (m_functions.count(_name))
-		m_functions.at(_name) = m_context.function(_name.c_str(), z3Sort(fSort.domain), z3Sort(*fSort.codomain));
+	{
+		z3::func_decl function = m_context.function(_name.c_str(), z3Sort(fSort.domain), z3Sort(*fSort.codomain));
+		if (!z3::eq(function, m_functions.at(_name)))
+			m_translations.clear();
+		m_functions.at(_name) = function;
+	}
 	else
 		m_functions.emplace(_name, m_context.function(_name.c_str(), z3Sort(fSort.domain), z3Sort(*fSort.codomain)));
 }
@@ -136,10 +159,29 @@ std::pair<CheckResult, std::vector<std::string>> Z3Interface::check(std::vector<
 		values.clear();
 	}
 
+	clearTranslations();
 	return std::make_pair(result, values);
 }
 
 z3::expr Z3Interface::toZ3Expr(Expression const& _expr)
+{
+	if (_expr.arguments.empty())
+		return toZ3ExprUncached(_expr);
+
+	// Copies of an expression share their arguments, so identical subterms are only translated once.
+	// Name and sort are compared as well, since they can be changed independently of the arguments.
+	if (
+		auto it = m_translations.find(_expr.arguments.id());
+		it != m_translations.end() && it->second.first.name == _expr.name && it->second.first.sort == _expr.sort
+	)
+		return it->second.second;
+
+	z3::expr result = toZ3ExprUncached(_expr);
+	m_translations.insert_or_assign(_expr.arguments.id(), std::make_pair(_expr, result));
+	return result;
+}
+
+z3::expr Z3Interface::toZ3ExprUncached(Expression const& _expr)
 {
 	if (_expr.arguments.empty() && m_constants.count(_expr.name))
 		return m_constants.at(_expr.name);
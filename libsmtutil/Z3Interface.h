@@ -21,6 +21,8 @@
 #include <libsmtutil/SolverInterface.h>
 #include <z3++.h>
 
+#include <unordered_map>
+
 namespace solidity::smtutil
 {
 
@@ -34,6 +36,8 @@ public:
 	Z3Interface(std::optional<unsigned> _queryTimeout = {});
 
 	static bool available();
+	/// @returns the version of the linked or loaded z3 library.
+	static std::string version();
 
 	void reset() override;
 
@@ -45,9 +49,17 @@ public:
 	void addAssertion(Expression const& _expr) override;
 	std::pair<CheckResult, std::vector<std::string>> check(std::vector<Expression> const& _expressionsToEvaluate) override;
 
+	/// Translates @a _expr, translating each subterm that is shared between copies only once.
+	/// The translations are kept until the current query is answered, that is, until the next
+	/// call to check(), pop(), reset() or clearTranslations().
 	z3::expr toZ3Expr(Expression const& _expr);
 	smtutil::Expression fromZ3Expr(z3::expr const& _expr);
 
+	/// Drops the memoised translations, so that they do not keep the expressions of answered queries alive.
+	void clearTranslations() { m_translations.clear(); }
+	/// @returns the number of memoised translations of compound expressions.
+	size_t translationCount() const { return m_translations.size(); }
+
 	std::map<std::string, z3::expr> constants() const { return m_constants; }
 	std::map<std::string, z3::func_decl> functions() const { return m_functions; }
 
@@ -60,6 +72,8 @@ public:
 private:
 	void declareFunction(std::string const& _name, Sort const& _sort);
 
+	z3::expr toZ3ExprUncached(Expression const& _expr);
+
 	z3::sort z3Sort(Sort const& _sort);
 	z3::sort_vector z3Sort(std::vector<SortPointer> const& _sorts);
 	smtutil::SortPointer fromZ3Sort(z3::sort const& _sort);
@@ -70,6 +84,10 @@ private:
 
 	std::map<std::string, z3::expr> m_constants;
 	std::map<std::string, z3::func_decl> m_functions;
+
+	/// Translations of compound expressions of the current query, keyed by the identity of their shared arguments.
+	/// The stored expressions keep the arguments alive, so that their identity is not reused.
+	std::unordered_map<void const*, std::pair<Expression, z3::expr>> m_translations;
 };
 
 }
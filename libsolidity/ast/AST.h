@@ -127,7 +127,8 @@ public:
 	virtual bool experimentalSolidityOnly() const { return false; }
 
 protected:
-	size_t const m_id = 0;
+	/// Only changed by Parser::shiftNodeIDs() before the node is used.
+	size_t m_id = 0;
 
 	template <class T>
 	T& initAnnotation() const
@@ -138,6 +139,8 @@ protected:
 	}
 
 private:
+	friend class Parser;
+
 	/// Annotation - is specialised in derived classes, is created upon request (because of polymorphism).
 	mutable std::unique_ptr<ASTAnnotation> m_annotation;
 	SourceLocation m_location;
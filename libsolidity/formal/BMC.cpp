@@ -20,6 +20,7 @@
 
 #include <libsolidity/formal/Cvc5SMTLib2Interface.h>
 #include <libsolidity/formal/SymbolicTypes.h>
+#include <libsolidity/interface/UniversalCallback.h>
 
 #include <libsmtutil/SMTLib2Interface.h>
 #include <libsmtutil/SMTPortfolio.h>
@@ -30,6 +31,9 @@
 #include <liblangutil/CharStream.h>
 #include <liblangutil/CharStreamProvider.h>
 
+#include <algorithm>
+#include <atomic>
+#include <future>
 #include <utility>
 
 #ifdef HAVE_Z3_DLOPEN
@@ -52,19 +56,12 @@ BMC::BMC(
 	ModelCheckerSettings _settings,
 	CharStreamProvider const& _charStreamProvider
 ):
-	SMTEncoder(_context, _settings, _errorReporter, _unsupportedErrorReporter, _charStreamProvider)
+	SMTEncoder(_context, _settings, _errorReporter, _unsupportedErrorReporter, _charStreamProvider),
+	m_smtlib2Responses(_smtlib2Responses),
+	m_smtCallback(_smtCallback)
 {
 	solAssert(!_settings.printQuery || _settings.solvers == SMTSolverChoice::SMTLIB2(), "Only SMTLib2 solver can be enabled to print queries");
-	std::vector<std::unique_ptr<SolverInterface>> solvers;
-	if (_settings.solvers.smtlib2)
-		solvers.emplace_back(std::make_unique<SMTLib2Interface>(_smtlib2Responses, _smtCallback, _settings.timeout));
-	if (_settings.solvers.cvc5)
-		solvers.emplace_back(std::make_unique<Cvc5SMTLib2Interface>(_smtCallback, _settings.timeout));
-#ifdef HAVE_Z3
-	if (_settings.solvers.z3 && Z3Interface::available())
-		solvers.emplace_back(std::make_unique<Z3Interface>(_settings.timeout));
-#endif
-	m_interface = std::make_unique<SMTPortfolio>(std::move(solvers), _settings.timeout);
+	m_interface = createSolver();
 #if defined (HAVE_Z3)
 	if (m_settings.solvers.z3)
 		if (!_smtlib2Responses.empty())
@@ -96,7 +93,14 @@ void BMC::analyze(SourceUnit const& _source, std::map<ASTNode const*, std::set<V
 
 	state().prepareForSourceUnit(_source, false);
 	m_solvedTargets = std::move(_solvedTargets);
-	m_context.setSolver(m_interface.get());
+	m_declaredVariables.clear();
+	m_workerSolvers.clear();
+	if (solvesTargetsConcurrently())
+		m_context.setSolver(m_interface.get(), [this](std::string const& _name, SortPointer const& _sort) {
+			m_declaredVariables.emplace_back(_name, _sort);
+		});
+	else
+		m_context.setSolver(m_interface.get());
 	m_context.reset();
 	m_context.setAssertionAccumulation(true);
 	m_variableUsage.setFunctionInlining(shouldInlineFunctionCall);
@@ -936,8 +940,105 @@ std::string BMC::targetDescription(BMCVerificationTarget const& _target)
 
 void BMC::checkVerificationTargets()
 {
+	if (solvesTargetsConcurrently() && m_verificationTargets.size() > 1)
+		checkVerificationTargetsConcurrently();
+	else
+		for (auto& target: m_verificationTargets)
+			checkVerificationTarget(target);
+}
+
+void BMC::checkVerificationTargetsConcurrently()
+{
+	// When solving sequentially, constant conditions are checked while the function is encoded,
+	// that is, before its other targets.
+	std::stable_partition(m_verificationTargets.begin(), m_verificationTargets.end(), [](BMCVerificationTarget const& _target) {
+		return _target.type == VerificationTargetType::ConstantCondition;
+	});
+
+	std::vector<PendingCondition> conditions;
+	m_pendingConditions = &conditions;
+	ScopeGuard resetPendingConditions([&] { m_pendingConditions = nullptr; });
 	for (auto& target: m_verificationTargets)
 		checkVerificationTarget(target);
+
+	// Every condition contains the complete path constraints of its target,
+	// so the solvers only need to know the variables declared so far.
+	// They are created here rather than in the worker threads because z3 sets some of its parameters globally.
+	size_t const jobs = std::min<size_t>(m_settings.jobs, conditions.size());
+	while (m_workerSolvers.size() < jobs)
+		m_workerSolvers.push_back({createSolver(), 0});
+	for (size_t i = 0; i < jobs; ++i)
+	{
+		WorkerSolver& worker = m_workerSolvers[i];
+		for (; worker.declaredVariables < m_declaredVariables.size(); ++worker.declaredVariables)
+		{
+			auto const& [name, sort] = m_declaredVariables[worker.declaredVariables];
+			worker.solver->declareVariable(name, sort);
+		}
+	}
+
+	using Result = std::tuple<CheckResult, std::vector<std::string>, std::optional<std::string>>;
+	// The results of the queries of each condition and the queries the solver could not answer.
+	std::vector<std::optional<std::pair<std::vector<Result>, std::vector<std::string>>>> results(conditions.size());
+	std::atomic<size_t> nextCondition = 0;
+	auto solveConditions = [&](SolverInterface& _solver) {
+		for (size_t i = nextCondition++; i < conditions.size(); i = nextCondition++)
+		{
+			size_t unhandledQueries = _solver.unhandledQueries().size();
+			std::vector<Result> queryResults;
+			for (smtutil::Expression const& query: conditions[i].queries)
+			{
+				_solver.push();
+				_solver.addAssertion(query);
+				queryResults.emplace_back(check(_solver, conditions[i].expressionsToEvaluate));
+				_solver.pop();
+			}
+			std::vector<std::string> newUnhandledQueries = _solver.unhandledQueries();
+			newUnhandledQueries.erase(newUnhandledQueries.begin(), newUnhandledQueries.begin() + static_cast<ptrdiff_t>(unhandledQueries));
+			results[i] = {std::move(queryResults), std::move(newUnhandledQueries)};
+		}
+	};
+	std::vector<std::future<void>> workers;
+	for (size_t i = 0; i < jobs; ++i)
+		workers.emplace_back(std::async(std::launch::async, solveConditions, std::ref(*m_workerSolvers[i].solver)));
+	for (auto& worker: workers)
+		worker.get();
+
+	for (size_t i = 0; i < conditions.size(); ++i)
+	{
+		PendingCondition const& condition = conditions[i];
+		solAssert(results[i]);
+		auto const& [queryResults, unhandledQueries] = *results[i];
+		for (Result const& queryResult: queryResults)
+			reportSolverError(std::get<2>(queryResult));
+		m_concurrentUnhandledQueries += unhandledQueries;
+		if (condition.target->type == VerificationTargetType::ConstantCondition)
+		{
+			solAssert(queryResults.size() == 2);
+			reportBooleanNotConstant(
+				*condition.target->expression,
+				std::get<0>(queryResults[0]),
+				std::get<0>(queryResults[1]),
+				*condition.callStack
+			);
+		}
+		else
+		{
+			solAssert(queryResults.size() == 1);
+			auto const& [result, values, solverError] = queryResults.front();
+			reportCondition(
+				*condition.target,
+				result,
+				values,
+				condition.expressionsToEvaluate,
+				condition.expressionNames,
+				*condition.callStack,
+				condition.location,
+				condition.errorHappens,
+				condition.errorMightHappen
+			);
+		}
+	}
 }
 
 void BMC::checkVerificationTarget(BMCVerificationTarget& _target)
@@ -975,6 +1076,25 @@ void BMC::checkVerificationTarget(BMCVerificationTarget& _target)
 
 void BMC::checkConstantCondition(BMCVerificationTarget& _target)
 {
+	// Do not check for const-ness if this is a constant.
+	if (dynamic_cast<Literal const*>(_target.expression))
+		return;
+
+	if (m_pendingConditions)
+	{
+		m_pendingConditions->push_back({
+			&_target,
+			{_target.constraints && _target.value, _target.constraints && !_target.value},
+			{},
+			{},
+			&_target.callStack,
+			_target.expression->location(),
+			{},
+			{}
+		});
+		return;
+	}
+
 	checkBooleanNotConstant(
 		*_target.expression,
 		_target.constraints,
@@ -1098,7 +1218,9 @@ void BMC::addVerificationTarget(
 		m_callStack,
 		modelExpressions()
 	};
-	if (_type == VerificationTargetType::ConstantCondition)
+	// When solving sequentially, constant conditions are checked right away, so that their
+	// queries only declare the variables created so far.
+	if (_type == VerificationTargetType::ConstantCondition && !solvesTargetsConcurrently())
 		checkVerificationTarget(target);
 	else
 		m_verificationTargets.emplace_back(std::move(target));
@@ -1106,6 +1228,42 @@ void BMC::addVerificationTarget(
 
 /// Solving.
 
+std::unique_ptr<SolverInterface> BMC::createSolver() const
+{
+	std::vector<std::unique_ptr<SolverInterface>> solvers;
+	if (m_settings.solvers.smtlib2)
+		solvers.emplace_back(std::make_unique<SMTLib2Interface>(m_smtlib2Responses, solverCallback(), m_settings.timeout));
+	if (m_settings.solvers.cvc5)
+		solvers.emplace_back(std::make_unique<Cvc5SMTLib2Interface>(solverCallback(), m_settings.timeout));
+#ifdef HAVE_Z3
+	if (m_settings.solvers.z3 && Z3Interface::available())
+		solvers.emplace_back(std::make_unique<Z3Interface>(m_settings.timeout));
+#endif
+	return std::make_unique<SMTPortfolio>(std::move(solvers), m_settings.timeout);
+}
+
+ReadCallback::Callback BMC::solverCallback() const
+{
+	// The solver command of UniversalCallback runs every query in its own process.
+	// The cvc5 interface also relies on finding it to configure the command.
+	if (!m_smtCallback || m_smtCallback.target<UniversalCallback>())
+		return m_smtCallback;
+	return [this](std::string const& _kind, std::string const& _query) {
+		std::lock_guard<std::mutex> lock(m_smtCallbackMutex);
+		return m_smtCallback(_kind, _query);
+	};
+}
+
+bool BMC::solvesTargetsConcurrently() const
+{
+#ifdef __EMSCRIPTEN__
+	return false;
+#else
+	// Unhandled smtlib2 queries are reported in the order in which they were created.
+	return m_settings.jobs > 1 && !m_settings.solvers.smtlib2 && !m_settings.printQuery;
+#endif
+}
+
 void BMC::checkCondition(
 	BMCVerificationTarget const& _target,
 	smtutil::Expression _condition,
@@ -1118,9 +1276,6 @@ void BMC::checkCondition(
 	smtutil::Expression const* _additionalValue
 )
 {
-	m_interface->push();
-	m_interface->addAssertion(_condition);
-
 	std::vector<smtutil::Expression> expressionsToEvaluate;
 	std::vector<std::string> expressionNames;
 	tie(expressionsToEvaluate, expressionNames) = _modelExpressions;
@@ -1130,10 +1285,54 @@ void BMC::checkCondition(
 			expressionsToEvaluate.emplace_back(*_additionalValue);
 			expressionNames.push_back(_additionalValueName);
 		}
+
+	if (m_pendingConditions)
+	{
+		m_pendingConditions->push_back({
+			&_target,
+			{std::move(_condition)},
+			std::move(expressionsToEvaluate),
+			std::move(expressionNames),
+			&_callStack,
+			_location,
+			_errorHappens,
+			_errorMightHappen
+		});
+		return;
+	}
+
+	m_interface->push();
+	m_interface->addAssertion(_condition);
 	smtutil::CheckResult result;
 	std::vector<std::string> values;
 	tie(result, values) = checkSatisfiableAndGenerateModel(expressionsToEvaluate);
+	m_interface->pop();
 
+	reportCondition(
+		_target,
+		result,
+		values,
+		expressionsToEvaluate,
+		expressionNames,
+		_callStack,
+		_location,
+		_errorHappens,
+		_errorMightHappen
+	);
+}
+
+void BMC::reportCondition(
+	BMCVerificationTarget const& _target,
+	smtutil::CheckResult _result,
+	std::vector<std::string> const& _values,
+	std::vector<smtutil::Expression> const& _expressionsToEvaluate,
+	std::vector<std::string> const& _expressionNames,
+	std::vector<SMTEncoder::CallStackEntry> const& _callStack,
+	SourceLocation const& _location,
+	ErrorId _errorHappens,
+	ErrorId _errorMightHappen
+)
+{
 	std::string extraComment = SMTEncoder::extraComment();
 	if (m_loopExecutionHappened)
 		extraComment +=
@@ -1150,7 +1349,7 @@ void BMC::checkCondition(
 	SecondarySourceLocation secondaryLocation{};
 	secondaryLocation.append(extraComment, SourceLocation{});
 
-	switch (result)
+	switch (_result)
 	{
 	case smtutil::CheckResult::SATISFIABLE:
 	{
@@ -1160,13 +1359,13 @@ void BMC::checkCondition(
 
 		std::ostringstream modelMessage;
 		// Sometimes models have complex smtlib2 expressions that SMTLib2Interface fails to parse.
-		if (values.size() == expressionNames.size())
+		if (_values.size() == _expressionNames.size())
 		{
 			modelMessage << "Counterexample:\n";
 			std::map<std::string, std::string> sortedModel;
-			for (size_t i = 0; i < values.size(); ++i)
-				if (expressionsToEvaluate.at(i).name != values.at(i))
-					sortedModel[expressionNames.at(i)] = values.at(i);
+			for (size_t i = 0; i < _values.size(); ++i)
+				if (_expressionsToEvaluate.at(i).name != _values.at(i))
+					sortedModel[_expressionNames.at(i)] = _values.at(i);
 
 			for (auto const& eval: sortedModel)
 				modelMessage << "  " << eval.first << " = " << eval.second << "\n";
@@ -1201,8 +1400,6 @@ void BMC::checkCondition(
 		m_errorReporter.warning(1823_error, _location, "BMC: Error trying to invoke SMT solver.");
 		break;
 	}
-
-	m_interface->pop();
 }
 
 void BMC::checkBooleanNotConstant(
@@ -1212,10 +1409,6 @@ void BMC::checkBooleanNotConstant(
 	std::vector<SMTEncoder::CallStackEntry> const& _callStack
 )
 {
-	// Do not check for const-ness if this is a constant.
-	if (dynamic_cast<Literal const*>(&_condition))
-		return;
-
 	m_interface->push();
 	m_interface->addAssertion(_constraints && _value);
 	auto positiveResult = checkSatisfiable();
@@ -1226,32 +1419,42 @@ void BMC::checkBooleanNotConstant(
 	auto negatedResult = checkSatisfiable();
 	m_interface->pop();
 
-	if (positiveResult == smtutil::CheckResult::ERROR || negatedResult == smtutil::CheckResult::ERROR)
+	reportBooleanNotConstant(_condition, positiveResult, negatedResult, _callStack);
+}
+
+void BMC::reportBooleanNotConstant(
+	Expression const& _condition,
+	smtutil::CheckResult _positiveResult,
+	smtutil::CheckResult _negatedResult,
+	std::vector<SMTEncoder::CallStackEntry> const& _callStack
+)
+{
+	if (_positiveResult == smtutil::CheckResult::ERROR || _negatedResult == smtutil::CheckResult::ERROR)
 		m_errorReporter.warning(8592_error, _condition.location(), "BMC: Error trying to invoke SMT solver.");
-	else if (positiveResult == smtutil::CheckResult::CONFLICTING || negatedResult == smtutil::CheckResult::CONFLICTING)
+	else if (_positiveResult == smtutil::CheckResult::CONFLICTING || _negatedResult == smtutil::CheckResult::CONFLICTING)
 		m_errorReporter.warning(3356_error, _condition.location(), "BMC: At least two SMT solvers provided conflicting answers. Results might not be sound.");
-	else if (positiveResult == smtutil::CheckResult::SATISFIABLE && negatedResult == smtutil::CheckResult::SATISFIABLE)
+	else if (_positiveResult == smtutil::CheckResult::SATISFIABLE && _negatedResult == smtutil::CheckResult::SATISFIABLE)
 	{
 		// everything fine.
 	}
-	else if (positiveResult == smtutil::CheckResult::UNKNOWN || negatedResult == smtutil::CheckResult::UNKNOWN)
+	else if (_positiveResult == smtutil::CheckResult::UNKNOWN || _negatedResult == smtutil::CheckResult::UNKNOWN)
 	{
 		// can't do anything.
 	}
-	else if (positiveResult == smtutil::CheckResult::UNSATISFIABLE && negatedResult == smtutil::CheckResult::UNSATISFIABLE)
+	else if (_positiveResult == smtutil::CheckResult::UNSATISFIABLE && _negatedResult == smtutil::CheckResult::UNSATISFIABLE)
 		m_errorReporter.warning(2512_error, _condition.location(), "BMC: Condition unreachable.", SMTEncoder::callStackMessage(_callStack));
 	else
 	{
 		std::string description;
-		if (positiveResult == smtutil::CheckResult::SATISFIABLE)
+		if (_positiveResult == smtutil::CheckResult::SATISFIABLE)
 		{
-			solAssert(negatedResult == smtutil::CheckResult::UNSATISFIABLE, "");
+			solAssert(_negatedResult == smtutil::CheckResult::UNSATISFIABLE, "");
 			description = "BMC: Condition is always true.";
 		}
 		else
 		{
-			solAssert(positiveResult == smtutil::CheckResult::UNSATISFIABLE, "");
-			solAssert(negatedResult == smtutil::CheckResult::SATISFIABLE, "");
+			solAssert(_positiveResult == smtutil::CheckResult::UNSATISFIABLE, "");
+			solAssert(_negatedResult == smtutil::CheckResult::SATISFIABLE, "");
 			description = "BMC: Condition is always false.";
 		}
 		m_errorReporter.warning(
@@ -1265,28 +1468,38 @@ void BMC::checkBooleanNotConstant(
 
 std::pair<smtutil::CheckResult, std::vector<std::string>>
 BMC::checkSatisfiableAndGenerateModel(std::vector<smtutil::Expression> const& _expressionsToEvaluate)
+{
+	if (m_settings.printQuery)
+	{
+		auto portfolio = dynamic_cast<smtutil::SMTPortfolio*>(m_interface.get());
+		std::string smtlibCode = portfolio->dumpQuery(_expressionsToEvaluate);
+		m_errorReporter.info(
+			6240_error,
+			"BMC: Requested query:\n" + smtlibCode
+		);
+	}
+	auto [result, values, solverError] = check(*m_interface, _expressionsToEvaluate);
+	reportSolverError(solverError);
+	return make_pair(result, values);
+}
+
+std::tuple<smtutil::CheckResult, std::vector<std::string>, std::optional<std::string>> BMC::check(
+	SolverInterface& _solver,
+	std::vector<smtutil::Expression> const& _expressionsToEvaluate
+)
 {
 	smtutil::CheckResult result;
 	std::vector<std::string> values;
+	std::optional<std::string> solverError;
 	try
 	{
-		if (m_settings.printQuery)
-		{
-			auto portfolio = dynamic_cast<smtutil::SMTPortfolio*>(m_interface.get());
-			std::string smtlibCode = portfolio->dumpQuery(_expressionsToEvaluate);
-			m_errorReporter.info(
-				6240_error,
-				"BMC: Requested query:\n" + smtlibCode
-			);
-		}
-		tie(result, values) = m_interface->check(_expressionsToEvaluate);
+		tie(result, values) = _solver.check(_expressionsToEvaluate);
 	}
 	catch (smtutil::SolverError const& _e)
 	{
-		std::string description("BMC: Error querying SMT solver");
+		solverError = "BMC: Error querying SMT solver";
 		if (_e.comment())
-			description += ": " + *_e.comment();
-		m_errorReporter.warning(8140_error, description);
+			*solverError += ": " + *_e.comment();
 		result = smtutil::CheckResult::ERROR;
 	}
 
@@ -1300,7 +1513,7 @@ BMC::checkSatisfiableAndGenerateModel(std::vector<smtutil::Expression> const& _e
 		catch (...) { }
 	}
 
-	return make_pair(result, values);
+	return {result, values, solverError};
 }
 
 smtutil::CheckResult BMC::checkSatisfiable()
@@ -1308,6 +1521,12 @@ smtutil::CheckResult BMC::checkSatisfiable()
 	return checkSatisfiableAndGenerateModel({}).first;
 }
 
+void BMC::reportSolverError(std::optional<std::string> const& _solverError)
+{
+	if (_solverError)
+		m_errorReporter.warning(8140_error, *_solverError);
+}
+
 void BMC::assignment(smt::SymbolicVariable& _symVar, smtutil::Expression const& _value)
 {
 	auto oldVar = _symVar.currentValue();
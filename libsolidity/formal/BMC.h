@@ -38,8 +38,11 @@
 #include <libsmtutil/SolverInterface.h>
 #include <liblangutil/UniqueErrorReporter.h>
 
+#include <mutex>
+#include <optional>
 #include <set>
 #include <string>
+#include <tuple>
 #include <vector>
 #include <stack>
 
@@ -73,7 +76,7 @@ public:
 	/// This is used if the SMT solver is not directly linked into this binary.
 	/// @returns a list of inputs to the SMT solver that were not part of the argument to
 	/// the constructor.
-	std::vector<std::string> unhandledQueries() { return m_interface->unhandledQueries(); }
+	std::vector<std::string> unhandledQueries() { return m_interface->unhandledQueries() + m_concurrentUnhandledQueries; }
 
 	/// @returns true if _funCall should be inlined, otherwise false.
 	/// @param _scopeContract The contract that contains the current function being analyzed.
@@ -159,6 +162,9 @@ private:
 	std::string targetDescription(BMCVerificationTarget const& _target);
 
 	void checkVerificationTargets();
+	/// Collects the verification conditions of all targets of the current function,
+	/// solves them on ModelCheckerSettings::jobs solver instances and reports them in order.
+	void checkVerificationTargetsConcurrently();
 	void checkVerificationTarget(BMCVerificationTarget& _target);
 	void checkConstantCondition(BMCVerificationTarget& _target);
 	void checkUnderflow(BMCVerificationTarget& _target);
@@ -175,6 +181,13 @@ private:
 
 	/// Solver related.
 	//@{
+	/// @returns a new portfolio of the selected solvers.
+	std::unique_ptr<smtutil::SolverInterface> createSolver() const;
+	/// @returns the callback given to the solvers, which calls m_smtCallback
+	/// one query at a time unless it is known to support concurrent queries.
+	ReadCallback::Callback solverCallback() const;
+	/// @returns true if the verification conditions of a function are solved concurrently on several solver instances.
+	bool solvesTargetsConcurrently() const;
 	/// Check that a condition can be satisfied.
 	void checkCondition(
 		BMCVerificationTarget const& _target,
@@ -187,18 +200,44 @@ private:
 		std::string const& _additionalValueName = "",
 		smtutil::Expression const* _additionalValue = nullptr
 	);
-	/// Checks that a boolean condition is not constant. Do not warn if the expression
-	/// is a literal constant.
+	/// Reports the result of checking the verification condition of @a _target.
+	void reportCondition(
+		BMCVerificationTarget const& _target,
+		smtutil::CheckResult _result,
+		std::vector<std::string> const& _values,
+		std::vector<smtutil::Expression> const& _expressionsToEvaluate,
+		std::vector<std::string> const& _expressionNames,
+		std::vector<CallStackEntry> const& _callStack,
+		langutil::SourceLocation const& _location,
+		langutil::ErrorId _errorHappens,
+		langutil::ErrorId _errorMightHappen
+	);
+	/// Checks that a boolean condition is not constant.
 	void checkBooleanNotConstant(
 		Expression const& _condition,
 		smtutil::Expression const& _constraints,
 		smtutil::Expression const& _value,
 		std::vector<CallStackEntry> const& _callStack
 	);
+	/// Reports whether @a _condition is constant, given the results of checking it and its negation.
+	void reportBooleanNotConstant(
+		Expression const& _condition,
+		smtutil::CheckResult _positiveResult,
+		smtutil::CheckResult _negatedResult,
+		std::vector<CallStackEntry> const& _callStack
+	);
 	std::pair<smtutil::CheckResult, std::vector<std::string>>
 	checkSatisfiableAndGenerateModel(std::vector<smtutil::Expression> const& _expressionsToEvaluate);
+	/// Checks the assertions of @a _solver without reporting anything, so that it can run concurrently for different solvers.
+	/// @returns the result, the values of @a _expressionsToEvaluate and the description of a solver error, if any.
+	static std::tuple<smtutil::CheckResult, std::vector<std::string>, std::optional<std::string>> check(
+		smtutil::SolverInterface& _solver,
+		std::vector<smtutil::Expression> const& _expressionsToEvaluate
+	);
 
 	smtutil::CheckResult checkSatisfiable();
+	/// Reports @a _solverError as returned by check(), if any.
+	void reportSolverError(std::optional<std::string> const& _solverError);
 	//@}
 
 	smtutil::Expression mergeVariablesFromLoopCheckpoints();
@@ -206,6 +245,42 @@ private:
 
 	std::unique_ptr<smtutil::SolverInterface> m_interface;
 
+	std::map<h256, std::string> const& m_smtlib2Responses;
+	ReadCallback::Callback const& m_smtCallback;
+	/// Serialises the calls of m_smtCallback by concurrently solving solver instances.
+	mutable std::mutex m_smtCallbackMutex;
+
+	/// Concurrent solving.
+	//@{
+	/// A verification condition whose check is deferred until all conditions of the current function are known.
+	struct PendingCondition
+	{
+		BMCVerificationTarget const* target;
+		/// The queries to solve. Constant conditions need one for the condition and one for its negation.
+		std::vector<smtutil::Expression> queries;
+		std::vector<smtutil::Expression> expressionsToEvaluate;
+		std::vector<std::string> expressionNames;
+		std::vector<CallStackEntry> const* callStack;
+		langutil::SourceLocation location;
+		langutil::ErrorId errorHappens;
+		langutil::ErrorId errorMightHappen;
+	};
+	/// If set, checkCondition collects the conditions here instead of solving them.
+	std::vector<PendingCondition>* m_pendingConditions = nullptr;
+
+	/// A solver instance in addition to m_interface and the number of variable declarations it already received.
+	struct WorkerSolver
+	{
+		std::unique_ptr<smtutil::SolverInterface> solver;
+		size_t declaredVariables = 0;
+	};
+	std::vector<WorkerSolver> m_workerSolvers;
+	/// All variables declared in m_interface, in declaration order, to be replayed into the worker solvers.
+	std::vector<std::pair<std::string, smtutil::SortPointer>> m_declaredVariables;
+	/// Queries of the worker solvers that could not be answered, in the order of their verification targets.
+	std::vector<std::string> m_concurrentUnhandledQueries;
+	//@}
+
 	/// Flags used for better warning messages.
 	bool m_loopExecutionHappened = false;
 	bool m_externalFunctionCallHappened = false;
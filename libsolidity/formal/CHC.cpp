@@ -32,11 +32,14 @@
 #include <libsolidity/formal/SymbolicTypes.h>
 
 #include <libsolidity/ast/TypeProvider.h>
+#include <libsolidity/interface/UniversalCallback.h>
 
 #include <libsmtutil/CHCSmtLib2Interface.h>
 #include <liblangutil/CharStreamProvider.h>
 #include <libsolutil/Algorithms.h>
+#include <libsolutil/JSON.h>
 #include <libsolutil/StringUtils.h>
+#include <libsolutil/Visitor.h>
 
 #ifdef HAVE_Z3_DLOPEN
 #include <z3_version.h>
@@ -49,7 +52,10 @@
 #include <range/v3/view/enumerate.hpp>
 #include <range/v3/view/reverse.hpp>
 
+#include <atomic>
 #include <charconv>
+#include <chrono>
+#include <future>
 #include <queue>
 
 using namespace solidity;
@@ -115,12 +121,10 @@ void CHC::analyze(SourceUnit const& _source)
 
 	checkVerificationTargets();
 
-	bool ranSolver = true;
 	// If ranSolver is true here it's because an SMT solver callback was
 	// actually given and the queries were solved,
 	// or Eldarica was chosen and was present in the system.
-	if (auto const* smtLibInterface = dynamic_cast<CHCSmtLib2Interface const*>(m_interface.get()))
-		ranSolver = smtLibInterface->unhandledQueries().empty();
+	bool ranSolver = unhandledQueries().empty();
 	if (!ranSolver)
 		m_errorReporter.warning(
 			3996_error,
@@ -133,9 +137,9 @@ void CHC::analyze(SourceUnit const& _source)
 std::vector<std::string> CHC::unhandledQueries() const
 {
 	if (auto smtlib2 = dynamic_cast<CHCSmtLib2Interface const*>(m_interface.get()))
-		return smtlib2->unhandledQueries();
+		return smtlib2->unhandledQueries() + m_concurrentUnhandledQueries;
 
-	return {};
+	return m_concurrentUnhandledQueries;
 }
 
 bool CHC::visit(ContractDefinition const& _contract)
@@ -692,7 +696,7 @@ void CHC::endVisit(IndexRangeAccess const& _range)
 	if (!sliceData.first)
 	{
 		for (auto pred: sliceData.second.predicates)
-			m_interface->registerRelation(pred->functor());
+			registerRelation(pred->functor());
 		for (auto const& rule: sliceData.second.rules)
 			addRule(rule, "");
 	}
@@ -1274,46 +1278,110 @@ void CHC::resetSourceAnalysis()
 	Predicate::reset();
 	ArraySlicePredicate::reset();
 	m_blockCounter = 0;
+	m_hornSystem.clear();
+	m_targetStatistics.clear();
+	m_ruleCount = 0;
+	m_relationCount = 0;
+	m_maxRelationArity = 0;
+	m_statisticsInterface.reset();
+	m_statisticsReplayed = 0;
+	m_concurrentUnhandledQueries.clear();
+
+	// z3::fixedpoint does not have a reset mechanism, so we need to create another.
+	if (m_settings.solvers.z3 || !m_interface)
+		m_interface = createHornSolver();
+	else
+	{
+		auto smtlib2Interface = dynamic_cast<CHCSmtLib2Interface*>(m_interface.get());
+		solAssert(smtlib2Interface);
+		smtlib2Interface->reset();
+	}
+
+	if (recordsHornSystem())
+		m_context.setSolver(variableSolver(*m_interface), [this](std::string const& _name, smtutil::SortPointer const& _sort) {
+			m_hornSystem.emplace_back(DeclaredVariable{_name, _sort});
+		});
+	else
+		m_context.setSolver(variableSolver(*m_interface));
 
+	m_context.reset();
+	m_context.resetUniqueId();
+	m_context.setAssertionAccumulation(false);
+}
+
+bool CHC::solvesTargetsConcurrently() const
+{
+#ifdef __EMSCRIPTEN__
+	return false;
+#else
+	// Queries to the smtlib2 solver are either answered by the given responses or collected
+	// as unhandled queries, both of which rely on the queries being created one after another.
+	return m_settings.jobs > 1 && (m_settings.solvers.z3 || m_settings.solvers.eld) && !m_settings.printQuery;
+#endif
+}
+
+bool CHC::recordsHornSystem() const
+{
+	// z3 receives the Horn system through its API, so the size of its queries is measured
+	// by replaying the Horn system into a separate SMT-LIB2 interface.
+	return solvesTargetsConcurrently() || (m_settings.printStats && m_settings.solvers.z3);
+}
+
+void CHC::replayHornSystem(CHCSolverInterface& _solver, size_t _begin) const
+{
+	for (size_t i = _begin; i < m_hornSystem.size(); ++i)
+		std::visit(GenericVisitor{
+			[&](DeclaredVariable const& _variable) { variableSolver(_solver)->declareVariable(_variable.name, _variable.sort); },
+			[&](DeclaredRelation const& _relation) { _solver.registerRelation(_relation.relation); },
+			[&](AddedRule const& _rule) { _solver.addRule(_rule.rule, _rule.name); }
+		}, m_hornSystem[i]);
+}
+
+std::unique_ptr<CHCSolverInterface> CHC::createHornSolver() const
+{
 	// At this point every enabled solver is available.
 	// If more than one Horn solver is selected we go with z3.
 	// We still need the ifdef because of Z3CHCInterface.
 	if (m_settings.solvers.z3)
 	{
 #ifdef HAVE_Z3
-		// z3::fixedpoint does not have a reset mechanism, so we need to create another.
-		m_interface = std::make_unique<Z3CHCInterface>(m_settings.timeout);
-		auto z3Interface = dynamic_cast<Z3CHCInterface const*>(m_interface.get());
-		solAssert(z3Interface, "");
-		m_context.setSolver(z3Interface->z3Interface());
+		return std::make_unique<Z3CHCInterface>(m_settings.timeout);
 #else
 		solAssert(false);
 #endif
 	}
-	else
-	{
-		solAssert(m_settings.solvers.smtlib2 || m_settings.solvers.eld);
-		if (!m_interface)
-		{
-			if (m_settings.solvers.eld)
-				m_interface = std::make_unique<EldaricaCHCSmtLib2Interface>(
-					m_smtCallback,
-					m_settings.timeout,
-					m_settings.invariants != ModelCheckerInvariants::None()
-				);
-			else
-				m_interface = std::make_unique<CHCSmtLib2Interface>(m_smtlib2Responses, m_smtCallback, m_settings.timeout);
-		}
 
-		auto smtlib2Interface = dynamic_cast<CHCSmtLib2Interface*>(m_interface.get());
-		solAssert(smtlib2Interface);
-		smtlib2Interface->reset();
-		m_context.setSolver(smtlib2Interface->smtlib2Interface());
-	}
+	solAssert(m_settings.solvers.smtlib2 || m_settings.solvers.eld);
+	if (m_settings.solvers.eld)
+		return std::make_unique<EldaricaCHCSmtLib2Interface>(
+			solverCallback(),
+			m_settings.timeout,
+			m_settings.invariants != ModelCheckerInvariants::None()
+		);
+	return std::make_unique<CHCSmtLib2Interface>(m_smtlib2Responses, solverCallback(), m_settings.timeout);
+}
 
-	m_context.reset();
-	m_context.resetUniqueId();
-	m_context.setAssertionAccumulation(false);
+ReadCallback::Callback CHC::solverCallback() const
+{
+	// The solver command of UniversalCallback runs every query in its own process.
+	// The Eldarica interface also relies on finding it to configure the command.
+	if (!m_smtCallback || m_smtCallback.target<UniversalCallback>())
+		return m_smtCallback;
+	return [this](std::string const& _kind, std::string const& _query) {
+		std::lock_guard<std::mutex> lock(m_smtCallbackMutex);
+		return m_smtCallback(_kind, _query);
+	};
+}
+
+smtutil::SolverInterface* CHC::variableSolver(CHCSolverInterface& _hornSolver)
+{
+#ifdef HAVE_Z3
+	if (auto z3Interface = dynamic_cast<Z3CHCInterface const*>(&_hornSolver))
+		return z3Interface->z3Interface();
+#endif
+	auto smtlib2Interface = dynamic_cast<CHCSmtLib2Interface const*>(&_hornSolver);
+	solAssert(smtlib2Interface);
+	return smtlib2Interface->smtlib2Interface();
 }
 
 void CHC::resetContractAnalysis()
@@ -1447,7 +1515,7 @@ SortPointer CHC::sort(ASTNode const* _node)
 Predicate const* CHC::createSymbolicBlock(SortPointer _sort, std::string const& _name, PredicateType _predType, ASTNode const* _node, ContractDefinition const* _contractContext)
 {
 	auto const* block = Predicate::create(_sort, _name, _predType, m_context, _node, _contractContext, m_scopes);
-	m_interface->registerRelation(block->functor());
+	registerRelation(block->functor());
 	return block;
 }
 
@@ -1744,7 +1812,7 @@ void CHC::createErrorBlock()
 		"error_target_" + std::to_string(m_context.newUniqueId()),
 		PredicateType::Error
 	);
-	m_interface->registerRelation(m_errorPredicate->functor());
+	registerRelation(m_errorPredicate->functor());
 }
 
 void CHC::connectBlocks(smtutil::Expression const& _from, smtutil::Expression const& _to, smtutil::Expression const& _constraints)
@@ -1913,16 +1981,26 @@ smtutil::Expression CHC::predicate(
 	return callPredicate(args);
 }
 
+void CHC::registerRelation(smtutil::Expression const& _relation)
+{
+	if (recordsHornSystem())
+		m_hornSystem.emplace_back(DeclaredRelation{_relation});
+	++m_relationCount;
+	if (auto sort = std::dynamic_pointer_cast<FunctionSort>(_relation.sort))
+		m_maxRelationArity = std::max(m_maxRelationArity, sort->domain.size());
+	m_interface->registerRelation(_relation);
+}
+
 void CHC::addRule(smtutil::Expression const& _rule, std::string const& _ruleName)
 {
+	if (recordsHornSystem())
+		m_hornSystem.emplace_back(AddedRule{_rule, _ruleName});
+	++m_ruleCount;
 	m_interface->addRule(_rule, _ruleName);
 }
 
-std::tuple<CheckResult, smtutil::Expression, CHCSolverInterface::CexGraph> CHC::query(smtutil::Expression const& _query, langutil::SourceLocation const& _location)
+CHC::QueryResult CHC::query(smtutil::Expression const& _query, langutil::SourceLocation const& _location)
 {
-	CheckResult result;
-	smtutil::Expression invariant(true);
-	CHCSolverInterface::CexGraph cex;
 	if (m_settings.printQuery)
 	{
 		auto smtLibInterface = dynamic_cast<CHCSmtLib2Interface*>(m_interface.get());
@@ -1933,38 +2011,49 @@ std::tuple<CheckResult, smtutil::Expression, CHCSolverInterface::CexGraph> CHC::
 			"CHC: Requested query:\n" + smtLibCode
 		);
 	}
-	std::tie(result, invariant, cex) = m_interface->query(_query);
-	switch (result)
-	{
-	case CheckResult::SATISFIABLE:
-	{
+	QueryResult result = solve(*m_interface, _query);
+	reportQueryResult(std::get<0>(result), _location);
+	return result;
+}
+
+CHC::QueryResult CHC::solve(CHCSolverInterface& _solver, smtutil::Expression const& _query) const
+{
+	CheckResult result;
+	smtutil::Expression invariant(true);
+	CHCSolverInterface::CexGraph cex;
+	std::tie(result, invariant, cex) = _solver.query(_query);
 	// We still need the ifdef because of Z3CHCInterface.
-		if (m_settings.solvers.z3)
-		{
+	if (result == CheckResult::SATISFIABLE && m_settings.solvers.z3)
+	{
 #ifdef HAVE_Z3
-			// Even though the problem is SAT, Spacer's pre processing makes counterexamples incomplete.
-			// We now disable those optimizations and check whether we can still solve the problem.
-			auto* spacer = dynamic_cast<Z3CHCInterface*>(m_interface.get());
-			solAssert(spacer, "");
-			spacer->setSpacerOptions(false);
+		// Even though the problem is SAT, Spacer's pre processing makes counterexamples incomplete.
+		// We now disable those optimizations and check whether we can still solve the problem.
+		auto* spacer = dynamic_cast<Z3CHCInterface*>(&_solver);
+		solAssert(spacer, "");
+		spacer->setSpacerOptions(false);
 
-			CheckResult resultNoOpt;
-			smtutil::Expression invariantNoOpt(true);
-			CHCSolverInterface::CexGraph cexNoOpt;
-			std::tie(resultNoOpt, invariantNoOpt, cexNoOpt) = m_interface->query(_query);
+		CheckResult resultNoOpt;
+		smtutil::Expression invariantNoOpt(true);
+		CHCSolverInterface::CexGraph cexNoOpt;
+		std::tie(resultNoOpt, invariantNoOpt, cexNoOpt) = _solver.query(_query);
 
-			if (resultNoOpt == CheckResult::SATISFIABLE)
-				cex = std::move(cexNoOpt);
+		if (resultNoOpt == CheckResult::SATISFIABLE)
+			cex = std::move(cexNoOpt);
 
-			spacer->setSpacerOptions(true);
+		spacer->setSpacerOptions(true);
 #else
-			solAssert(false);
+		solAssert(false);
 #endif
-		}
-		break;
 	}
+	return {result, invariant, cex};
+}
+
+void CHC::reportQueryResult(CheckResult _result, langutil::SourceLocation const& _location)
+{
+	switch (_result)
+	{
+	case CheckResult::SATISFIABLE:
 	case CheckResult::UNSATISFIABLE:
-		break;
 	case CheckResult::UNKNOWN:
 		break;
 	case CheckResult::CONFLICTING:
@@ -1974,7 +2063,6 @@ std::tuple<CheckResult, smtutil::Expression, CHCSolverInterface::CexGraph> CHC::
 		m_errorReporter.warning(1218_error, _location, "CHC: Error trying to invoke SMT solver.");
 		break;
 	}
-	return {result, invariant, cex};
 }
 
 void CHC::verificationTargetEncountered(
@@ -2077,14 +2165,24 @@ void CHC::checkVerificationTargets()
 	}
 
 	std::set<unsigned> checkedErrorIds;
-	for (auto const& [targetId, placeholders]: targetEntryPoints)
-	{
-		auto const& target = m_verificationTargets.at(targetId);
-		auto [errorType, errorReporterId] = targetDescription(target);
+	if (solvesTargetsConcurrently() && targetEntryPoints.size() > 1)
+		checkAndReportTargetsConcurrently(targetEntryPoints);
+	else
+		for (auto const& [targetId, placeholders]: targetEntryPoints)
+		{
+			auto const& target = m_verificationTargets.at(targetId);
+			auto [errorType, errorReporterId] = targetDescription(target);
 
-		checkAndReportTarget(target, placeholders, errorReporterId, errorType + " happens here.", errorType + " might happen here.");
-		checkedErrorIds.insert(target.errorId);
-	}
+			checkAndReportTarget(target, placeholders, errorReporterId, errorType + " happens here.", errorType + " might happen here.");
+		}
+	for (unsigned targetId: targetEntryPoints | ranges::views::keys)
+		checkedErrorIds.insert(m_verificationTargets.at(targetId).errorId);
+
+	if (m_settings.printStats)
+		m_errorReporter.info(
+			4189_error,
+			"CHC: Statistics:\n" + formatStatistics()
+		);
 
 	auto toReport = m_unsafeTargets;
 	if (m_settings.showUnproved)
@@ -2200,9 +2298,172 @@ void CHC::checkAndReportTarget(
 	std::string _unknownMsg
 )
 {
-	if (m_unsafeTargets.count(_target.errorNode) && m_unsafeTargets.at(_target.errorNode).count(_target.type))
+	if (alreadyUnsafe(_target))
 		return;
 
+	size_t const previousRules = m_ruleCount;
+	encodeTarget(_target, _placeholders);
+	std::optional<size_t> querySize;
+	if (m_settings.printStats)
+		querySize = queryBytes(error());
+	auto start = std::chrono::steady_clock::now();
+	QueryResult result = query(error(), _target.errorNode->location());
+	if (m_settings.printStats)
+		recordStatistics(_target, m_ruleCount - previousRules, querySize, std::chrono::steady_clock::now() - start, std::get<0>(result));
+	reportTarget(_target, error().name, result, _errorReporterId, _satMsg, _unknownMsg);
+}
+
+void CHC::checkAndReportTargetsConcurrently(std::map<unsigned, std::vector<CHCQueryPlaceholder>> const& _targetEntryPoints)
+{
+	// Targets are encoded before anything is solved, so unlike in the sequential mode
+	// the targets of an error node that turns out to be unsafe are encoded and solved as well.
+	// Their results are discarded below, which keeps the reported results identical.
+	std::vector<std::pair<CHCVerificationTarget const*, smtutil::Expression>> targets;
+	std::vector<std::pair<size_t, std::optional<size_t>>> targetSizes;
+	for (auto const& [targetId, placeholders]: _targetEntryPoints)
+	{
+		auto const& target = m_verificationTargets.at(targetId);
+		size_t const previousRules = m_ruleCount;
+		encodeTarget(target, placeholders);
+		targets.emplace_back(&target, error());
+		targetSizes.emplace_back(m_ruleCount - previousRules, std::nullopt);
+	}
+	// Measured before solving, since the SMT-LIB2 interface must not be used concurrently.
+	if (m_settings.printStats)
+		for (size_t i = 0; i < targets.size(); ++i)
+			targetSizes[i].second = queryBytes(targets[i].second);
+
+	// The solver instances receive a replay of the complete Horn system. m_interface is not one of them,
+	// so that the queries they cannot answer are collected per target and merged in the order of the targets.
+	// They are created here rather than in the worker threads because z3 sets some of its parameters globally.
+	std::vector<std::unique_ptr<CHCSolverInterface>> solvers;
+	for (size_t i = 0; i < std::min<size_t>(m_settings.jobs, targets.size()); ++i)
+	{
+		auto solver = createHornSolver();
+		replayHornSystem(*solver);
+		solvers.emplace_back(std::move(solver));
+	}
+
+	std::vector<std::optional<QueryResult>> results(targets.size());
+	std::vector<std::chrono::steady_clock::duration> durations(targets.size());
+	std::vector<std::vector<std::string>> unhandledQueries(targets.size());
+	std::atomic<size_t> nextTarget = 0;
+	auto solveTargets = [&](CHCSolverInterface& _solver) {
+		auto const* smtlib2Interface = dynamic_cast<CHCSmtLib2Interface const*>(&_solver);
+		for (size_t i = nextTarget++; i < targets.size(); i = nextTarget++)
+		{
+			size_t previousUnhandledQueries = smtlib2Interface ? smtlib2Interface->unhandledQueries().size() : 0;
+			auto start = std::chrono::steady_clock::now();
+			results[i] = solve(_solver, targets[i].second);
+			durations[i] = std::chrono::steady_clock::now() - start;
+			if (smtlib2Interface)
+			{
+				unhandledQueries[i] = smtlib2Interface->unhandledQueries();
+				unhandledQueries[i].erase(
+					unhandledQueries[i].begin(),
+					unhandledQueries[i].begin() + static_cast<ptrdiff_t>(previousUnhandledQueries)
+				);
+			}
+		}
+	};
+	std::vector<std::future<void>> workers;
+	for (auto& solver: solvers | ranges::views::drop(1))
+		workers.emplace_back(std::async(std::launch::async, solveTargets, std::ref(*solver)));
+	solveTargets(*solvers.front());
+	for (auto& worker: workers)
+		worker.get();
+
+	for (size_t i = 0; i < targets.size(); ++i)
+	{
+		auto const& [target, errorPredicate] = targets[i];
+		if (alreadyUnsafe(*target))
+			continue;
+		m_concurrentUnhandledQueries += unhandledQueries[i];
+		auto [errorType, errorReporterId] = targetDescription(*target);
+		solAssert(results[i]);
+		if (m_settings.printStats)
+			recordStatistics(*target, targetSizes[i].first, targetSizes[i].second, durations[i], std::get<0>(*results[i]));
+		reportQueryResult(std::get<0>(*results[i]), target->errorNode->location());
+		reportTarget(*target, errorPredicate.name, *results[i], errorReporterId, errorType + " happens here.", errorType + " might happen here.");
+	}
+}
+
+size_t CHC::queryBytes(smtutil::Expression const& _query)
+{
+	if (auto smtlib2Interface = dynamic_cast<CHCSmtLib2Interface*>(m_interface.get()))
+		return smtlib2Interface->dumpQuery(_query).size();
+
+	if (!m_statisticsInterface)
+		m_statisticsInterface = std::make_unique<CHCSmtLib2Interface>();
+	replayHornSystem(*m_statisticsInterface, m_statisticsReplayed);
+	m_statisticsReplayed = m_hornSystem.size();
+	return m_statisticsInterface->dumpQuery(_query).size();
+}
+
+void CHC::recordStatistics(
+	CHCVerificationTarget const& _target,
+	size_t _targetRules,
+	std::optional<size_t> _queryBytes,
+	std::chrono::steady_clock::duration _wallTime,
+	CheckResult _result
+)
+{
+	m_targetStatistics.push_back({
+		&_target,
+		m_ruleCount,
+		_targetRules,
+		m_relationCount,
+		m_maxRelationArity,
+		_queryBytes,
+		std::chrono::duration_cast<std::chrono::microseconds>(_wallTime).count(),
+		_result
+	});
+}
+
+std::string CHC::formatStatistics() const
+{
+	auto resultName = [](CheckResult _result) -> std::string {
+		switch (_result)
+		{
+		case CheckResult::SATISFIABLE: return "unsafe";
+		case CheckResult::UNSATISFIABLE: return "safe";
+		case CheckResult::UNKNOWN: return "unknown";
+		case CheckResult::CONFLICTING: return "conflicting";
+		case CheckResult::ERROR: return "error";
+		}
+		util::unreachable();
+	};
+
+	Json targets = Json::array();
+	for (TargetStatistics const& statistics: m_targetStatistics)
+	{
+		SourceLocation const& location = statistics.target->errorNode->location();
+		Json target;
+		target["target"] = ModelCheckerTargets::targetTypeToString.at(statistics.target->type);
+		target["source"] = location.sourceName ? Json(*location.sourceName) : Json();
+		target["start"] = location.start;
+		target["end"] = location.end;
+		target["rules"] = statistics.rules;
+		target["targetRules"] = statistics.targetRules;
+		target["relations"] = statistics.relations;
+		target["maxPredicateArity"] = statistics.maxPredicateArity;
+		target["queryBytes"] = statistics.queryBytes ? Json(*statistics.queryBytes) : Json();
+		target["wallTimeMicroseconds"] = statistics.wallTimeMicroseconds;
+		target["result"] = resultName(statistics.result);
+		targets.emplace_back(std::move(target));
+	}
+	Json output;
+	output["targets"] = std::move(targets);
+	return jsonPrettyPrint(output);
+}
+
+bool CHC::alreadyUnsafe(CHCVerificationTarget const& _target) const
+{
+	return m_unsafeTargets.count(_target.errorNode) && m_unsafeTargets.at(_target.errorNode).count(_target.type);
+}
+
+void CHC::encodeTarget(CHCVerificationTarget const& _target, std::vector<CHCQueryPlaceholder> const& _placeholders)
+{
 	createErrorBlock();
 	for (auto const& placeholder: _placeholders)
 		connectBlocks(
@@ -2210,8 +2471,19 @@ void CHC::checkAndReportTarget(
 			error(),
 			placeholder.constraints && placeholder.errorExpression == _target.errorId
 		);
+}
+
+void CHC::reportTarget(
+	CHCVerificationTarget const& _target,
+	std::string const& _errorPredicate,
+	QueryResult const& _result,
+	ErrorId _errorReporterId,
+	std::string const& _satMsg,
+	std::string const& _unknownMsg
+)
+{
+	auto const& [result, invariant, model] = _result;
 	auto const& location = _target.errorNode->location();
-	auto [result, invariant, model] = query(error(), location);
 	if (result == CheckResult::UNSATISFIABLE)
 	{
 		m_safeTargets[_target.errorNode].insert(_target);
@@ -2227,7 +2499,7 @@ void CHC::checkAndReportTarget(
 	else if (result == CheckResult::SATISFIABLE)
 	{
 		solAssert(!_satMsg.empty(), "");
-		auto cex = generateCounterexample(model, error().name);
+		auto cex = generateCounterexample(model, _errorPredicate);
 		if (cex)
 			m_unsafeTargets[_target.errorNode][_target.type] = {
 				_errorReporterId,
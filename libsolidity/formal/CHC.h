@@ -37,6 +37,7 @@
 
 #include <libsolidity/interface/ReadFile.h>
 
+#include <libsmtutil/CHCSmtLib2Interface.h>
 #include <libsmtutil/CHCSolverInterface.h>
 
 #include <liblangutil/SourceLocation.h>
@@ -44,9 +45,12 @@
 
 #include <boost/algorithm/string/join.hpp>
 
+#include <chrono>
 #include <map>
+#include <mutex>
 #include <optional>
 #include <set>
+#include <variant>
 
 namespace solidity::frontend
 {
@@ -281,11 +285,32 @@ private:
 
 	/// Solver related.
 	//@{
+	using QueryResult = std::tuple<smtutil::CheckResult, smtutil::Expression, smtutil::CHCSolverInterface::CexGraph>;
+
+	/// @returns true if verification targets are solved concurrently on several solver instances.
+	bool solvesTargetsConcurrently() const;
+	/// @returns a new Horn solver instance for the selected solvers.
+	std::unique_ptr<smtutil::CHCSolverInterface> createHornSolver() const;
+	/// @returns the callback given to the solver instances, which calls m_smtCallback
+	/// one query at a time unless it is known to support concurrent queries.
+	ReadCallback::Callback solverCallback() const;
+	/// @returns true if the Horn system is recorded in m_hornSystem.
+	bool recordsHornSystem() const;
+	/// Sends the entries of m_hornSystem starting at @a _begin to @a _solver.
+	void replayHornSystem(smtutil::CHCSolverInterface& _solver, size_t _begin = 0) const;
+	/// @returns the solver of @a _hornSolver that SMT variables are declared in.
+	static smtutil::SolverInterface* variableSolver(smtutil::CHCSolverInterface& _hornSolver);
+	/// Registers a predicate as a relation of the Horn system.
+	void registerRelation(smtutil::Expression const& _relation);
 	/// Adds Horn rule to the solver.
 	void addRule(smtutil::Expression const& _rule, std::string const& _ruleName);
 	/// @returns <true, invariant, empty> if query is unsatisfiable (safe).
 	/// @returns <false, Expression(true), model> otherwise.
-	std::tuple<smtutil::CheckResult, smtutil::Expression, smtutil::CHCSolverInterface::CexGraph> query(smtutil::Expression const& _query, langutil::SourceLocation const& _location);
+	QueryResult query(smtutil::Expression const& _query, langutil::SourceLocation const& _location);
+	/// Queries @a _solver without reporting anything, so that it can run concurrently for different solvers.
+	QueryResult solve(smtutil::CHCSolverInterface& _solver, smtutil::Expression const& _query) const;
+	/// Reports solver failures of a query for the target at @a _location.
+	void reportQueryResult(smtutil::CheckResult _result, langutil::SourceLocation const& _location);
 
 	void verificationTargetEncountered(ASTNode const* const _errorNode, VerificationTargetType _type, smtutil::Expression const& _errorCondition);
 
@@ -299,6 +324,35 @@ private:
 		std::string _satMsg,
 		std::string _unknownMsg = ""
 	);
+	/// Creates the error blocks of all targets, solves them on ModelCheckerSettings::jobs solver instances
+	/// and reports the results in the order of @a _targetEntryPoints.
+	void checkAndReportTargetsConcurrently(std::map<unsigned, std::vector<CHCQueryPlaceholder>> const& _targetEntryPoints);
+	/// @returns true if @a _target was already found to be unsafe, in which case it is not checked again.
+	bool alreadyUnsafe(CHCVerificationTarget const& _target) const;
+	/// Connects all @a _placeholders of @a _target to a new error block.
+	void encodeTarget(CHCVerificationTarget const& _target, std::vector<CHCQueryPlaceholder> const& _placeholders);
+	/// Records the solver @a _result for @a _target, whose error predicate is named @a _errorPredicate.
+	void reportTarget(
+		CHCVerificationTarget const& _target,
+		std::string const& _errorPredicate,
+		QueryResult const& _result,
+		langutil::ErrorId _errorReporterId,
+		std::string const& _satMsg,
+		std::string const& _unknownMsg
+	);
+
+	/// @returns the size of @a _query in SMT-LIB2, including the complete Horn system.
+	size_t queryBytes(smtutil::Expression const& _query);
+	/// Records the statistics of the query for @a _target, whose error block was connected by @a _targetRules rules.
+	void recordStatistics(
+		CHCVerificationTarget const& _target,
+		size_t _targetRules,
+		std::optional<size_t> _queryBytes,
+		std::chrono::steady_clock::duration _wallTime,
+		smtutil::CheckResult _result
+	);
+	/// @returns the recorded statistics of all queries as JSON.
+	std::string formatStatistics() const;
 
 	std::pair<std::string, langutil::ErrorId> targetDescription(CHCVerificationTarget const& _target);
 
@@ -470,8 +524,59 @@ private:
 	/// CHC solver.
 	std::unique_ptr<smtutil::CHCSolverInterface> m_interface;
 
+	/// Entries of the Horn system in the order in which they were sent to m_interface.
+	/// Only recorded if verification targets are solved concurrently, in which case
+	/// they are replayed into the additional solver instances, or if the sizes of z3 queries are measured.
+	//@{
+	struct DeclaredVariable
+	{
+		std::string name;
+		smtutil::SortPointer sort;
+	};
+	struct DeclaredRelation
+	{
+		smtutil::Expression relation;
+	};
+	struct AddedRule
+	{
+		smtutil::Expression rule;
+		std::string name;
+	};
+	std::vector<std::variant<DeclaredVariable, DeclaredRelation, AddedRule>> m_hornSystem;
+	//@}
+
+	/// Query statistics, only collected if ModelCheckerSettings::printStats is set.
+	//@{
+	struct TargetStatistics
+	{
+		CHCVerificationTarget const* target;
+		/// Rules, relations and maximum relation arity of the Horn system at the time of the query.
+		size_t rules;
+		size_t targetRules;
+		size_t relations;
+		size_t maxPredicateArity;
+		/// Not measured if the statistics are disabled for the solver.
+		std::optional<size_t> queryBytes;
+		int64_t wallTimeMicroseconds;
+		smtutil::CheckResult result;
+	};
+	std::vector<TargetStatistics> m_targetStatistics;
+	size_t m_ruleCount = 0;
+	size_t m_relationCount = 0;
+	size_t m_maxRelationArity = 0;
+	/// Receives a replay of m_hornSystem to measure the size of queries if m_interface does not use SMT-LIB2.
+	std::unique_ptr<smtutil::CHCSmtLib2Interface> m_statisticsInterface;
+	/// Number of entries of m_hornSystem already sent to m_statisticsInterface.
+	size_t m_statisticsReplayed = 0;
+	//@}
+
 	std::map<util::h256, std::string> const& m_smtlib2Responses;
 	ReadCallback::Callback const& m_smtCallback;
+	/// Serialises the calls of m_smtCallback by concurrently solving solver instances.
+	mutable std::mutex m_smtCallbackMutex;
+	/// Queries of the concurrently solving solver instances that could not be answered,
+	/// in the order of their verification targets.
+	std::vector<std::string> m_concurrentUnhandledQueries;
 };
 
 }
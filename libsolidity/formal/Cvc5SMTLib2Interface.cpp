@@ -27,6 +27,8 @@ Cvc5SMTLib2Interface::Cvc5SMTLib2Interface(
 	std::optional<unsigned int> _queryTimeout
 ): SMTLib2Interface({}, std::move(_smtCallback), _queryTimeout)
 {
+	// No responses are looked up by the text of the queries, so shared subterms can be let-bound.
+	setLetBindSharedSubterms(true);
 }
 
 void Cvc5SMTLib2Interface::setupSmtCallback() {
@@ -28,6 +28,8 @@ EldaricaCHCSmtLib2Interface::EldaricaCHCSmtLib2Interface(
 	bool computeInvariants
 ): CHCSmtLib2Interface({}, std::move(_smtCallback), _queryTimeout), m_computeInvariants(computeInvariants)
 {
+	// No responses are looked up by the text of the queries, so shared subterms can be let-bound.
+	m_smtlib2->setLetBindSharedSubterms(true);
 }
 
 void EldaricaCHCSmtLib2Interface::setupSmtCallback()
@@ -23,6 +23,7 @@
 
 #include <libsmtutil/SolverInterface.h>
 
+#include <functional>
 #include <map>
 
 namespace solidity::frontend::smt
@@ -48,12 +49,16 @@ public:
 	/// To be used before a model checking engine starts.
 	void clear();
 
+	using VariableDeclarationObserver = std::function<void(std::string const&, smtutil::SortPointer const&)>;
+
 	/// Sets the current solver used by the current engine for
 	/// SMT variable declaration.
-	void setSolver(smtutil::SolverInterface* _solver)
+	/// @param _declarationObserver if given, is notified of every variable declared through the context.
+	void setSolver(smtutil::SolverInterface* _solver, VariableDeclarationObserver _declarationObserver = {})
 	{
 		solAssert(_solver, "");
 		m_solver = _solver;
+		m_declarationObserver = std::move(_declarationObserver);
 	}
 
 	/// Sets whether the context should conjoin assertions in the assertion stack.
@@ -63,6 +68,8 @@ public:
 	smtutil::Expression newVariable(std::string _name, smtutil::SortPointer _sort)
 	{
 		solAssert(m_solver, "");
+		if (m_declarationObserver)
+			m_declarationObserver(_name, _sort);
 		return m_solver->newVariable(std::move(_name), std::move(_sort));
 	}
 
@@ -173,6 +180,7 @@ private:
 	//@{
 	/// Solver can be SMT solver or Horn solver in the future.
 	smtutil::SolverInterface* m_solver = nullptr;
+	VariableDeclarationObserver m_declarationObserver;
 
 	/// Assertion stack.
 	std::vector<smtutil::Expression> m_assertions;
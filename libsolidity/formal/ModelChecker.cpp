@@ -40,14 +40,19 @@ ModelChecker::ModelChecker(
 	langutil::CharStreamProvider const& _charStreamProvider,
 	std::map<h256, std::string> const& _smtlib2Responses,
 	ModelCheckerSettings _settings,
-	ReadCallback::Callback const& _smtCallback
+	ReadCallback::Callback const& _smtCallback,
+	EVMVersion _evmVersion
 ):
 	m_errorReporter(_errorReporter),
+	m_charStreamProvider(_charStreamProvider),
 	m_settings(std::move(_settings)),
+	m_evmVersion(_evmVersion),
 	m_context(),
 	m_bmc(m_context, m_uniqueErrorReporter, m_unsupportedErrorReporter, _smtlib2Responses, _smtCallback, m_settings, _charStreamProvider),
 	m_chc(m_context, m_uniqueErrorReporter, m_unsupportedErrorReporter, _smtlib2Responses, _smtCallback, m_settings, _charStreamProvider)
 {
+	if (m_settings.cacheDirectory && ModelCheckerCache::canCache(m_settings))
+		m_cache.emplace(*m_settings.cacheDirectory);
 }
 
 // TODO This should be removed for 0.9.0.
@@ -90,6 +95,40 @@ void ModelChecker::checkRequestedSourcesAndContracts(std::vector<std::shared_ptr
 	}
 }
 
+void ModelChecker::analyze(std::vector<std::shared_ptr<SourceUnit>> const& _sources)
+{
+	std::optional<h256> fingerprint;
+	if (m_cache && m_settings.engine.any())
+	{
+		fingerprint = ModelCheckerCache::fingerprint(_sources, m_settings, m_evmVersion, m_charStreamProvider);
+		if (std::optional<ModelCheckerCache::Entry> cached = m_cache->load(*fingerprint))
+		{
+			// The stored diagnostics already contain the ones of checkRequestedSourcesAndContracts.
+			m_uniqueErrorReporter.clear();
+			m_errorReporter.append(cached->errors);
+			return;
+		}
+	}
+
+	size_t const previousErrors = m_errorReporter.errors().size();
+	for (auto const& source: _sources)
+		if (source)
+			analyze(*source);
+
+	if (
+		fingerprint &&
+		!m_cache->store(*fingerprint, {ErrorList(
+			m_errorReporter.errors().begin() + static_cast<ptrdiff_t>(previousErrors),
+			m_errorReporter.errors().end()
+		)})
+	)
+		m_errorReporter.warning(
+			3916_error,
+			SourceLocation(),
+			"Could not store the model checker results in \"" + *m_settings.cacheDirectory + "\"."
+		);
+}
+
 void ModelChecker::analyze(SourceUnit const& _source)
 {
 	// TODO This should be removed for 0.9.0.
@@ -26,6 +26,7 @@
 #include <libsolidity/formal/BMC.h>
 #include <libsolidity/formal/CHC.h>
 #include <libsolidity/formal/EncodingContext.h>
+#include <libsolidity/formal/ModelCheckerCache.h>
 #include <libsolidity/formal/ModelCheckerSettings.h>
 
 #include <libsolidity/interface/ReadFile.h>
@@ -54,7 +55,8 @@ public:
 		langutil::CharStreamProvider const& _charStreamProvider,
 		std::map<solidity::util::h256, std::string> const& _smtlib2Responses,
 		ModelCheckerSettings _settings = ModelCheckerSettings{},
-		ReadCallback::Callback const& _smtCallback = ReadCallback::Callback()
+		ReadCallback::Callback const& _smtCallback = ReadCallback::Callback(),
+		langutil::EVMVersion _evmVersion = langutil::EVMVersion()
 	);
 
 	// TODO This should be removed for 0.9.0.
@@ -64,7 +66,9 @@ public:
 	/// do not exist.
 	void checkRequestedSourcesAndContracts(std::vector<std::shared_ptr<SourceUnit>> const& _sources);
 
-	void analyze(SourceUnit const& _sources);
+	/// Runs the enabled engines on each of @a _sources or, if a cache directory is set and the
+	/// fingerprint of the compilation is known, reports the stored results instead.
+	void analyze(std::vector<std::shared_ptr<SourceUnit>> const& _sources);
 
 	/// This is used if the SMT solver is not directly linked into this binary.
 	/// @returns a list of inputs to the SMT solver that were not part of the argument to
@@ -79,6 +83,8 @@ public:
 	static smtutil::SMTSolverChoice checkRequestedSolvers(smtutil::SMTSolverChoice _enabled, langutil::ErrorReporter& _errorReporter);
 
 private:
+	void analyze(SourceUnit const& _source);
+
 	/// Error reporter from CompilerStack.
 	/// We need to append m_uniqueErrorReporter
 	/// to this one when the analysis is done.
@@ -95,8 +101,15 @@ private:
 	/// to m_errorReporter at the end of the analysis.
 	langutil::UniqueErrorReporter m_unsupportedErrorReporter;
 
+	langutil::CharStreamProvider const& m_charStreamProvider;
+
 	ModelCheckerSettings m_settings;
 
+	langutil::EVMVersion m_evmVersion;
+
+	/// Results of previous analyses, if a cache directory is set.
+	std::optional<ModelCheckerCache> m_cache;
+
 	/// Stores the context of the encoding.
 	smt::EncodingContext m_context;
 
@@ -0,0 +1,259 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+#include <libsolidity/formal/ModelCheckerCache.h>
+
+#include <libsolidity/ast/AST.h>
+#include <libsolidity/interface/Version.h>
+
+#ifdef HAVE_Z3
+#include <libsmtutil/Z3Interface.h>
+#endif
+
+#include <liblangutil/CharStream.h>
+#include <liblangutil/CharStreamProvider.h>
+
+#include <libsolutil/CommonIO.h>
+#include <libsolutil/JSON.h>
+#include <libsolutil/Keccak256.h>
+
+#include <boost/filesystem.hpp>
+
+#include <fstream>
+#include <map>
+
+using namespace solidity;
+using namespace solidity::util;
+using namespace solidity::langutil;
+using namespace solidity::frontend;
+
+namespace
+{
+
+/// @returns the settings that influence the reported diagnostics.
+/// The number of jobs is not part of it, since the results are the same for every number of jobs.
+Json settingsToJson(ModelCheckerSettings const& _settings)
+{
+	Json settings;
+	settings["bmcLoopIterations"] = _settings.bmcLoopIterations ? Json(*_settings.bmcLoopIterations) : Json();
+	Json contracts = Json::object();
+	for (auto const& [source, names]: _settings.contracts.contracts)
+		contracts[source] = names;
+	settings["contracts"] = std::move(contracts);
+	settings["divModNoSlacks"] = _settings.divModNoSlacks;
+	settings["engine"] = {_settings.engine.bmc, _settings.engine.chc};
+	settings["extCalls"] = _settings.externalCalls.isTrusted();
+	Json invariants = Json::array();
+	for (InvariantType invariant: _settings.invariants.invariants)
+		invariants.emplace_back(static_cast<int>(invariant));
+	settings["invariants"] = std::move(invariants);
+	settings["printQuery"] = _settings.printQuery;
+	settings["showProvedSafe"] = _settings.showProvedSafe;
+	settings["showUnproved"] = _settings.showUnproved;
+	settings["showUnsupported"] = _settings.showUnsupported;
+	settings["solvers"] = {_settings.solvers.cvc5, _settings.solvers.eld, _settings.solvers.smtlib2, _settings.solvers.z3};
+	Json targets = Json::array();
+	for (VerificationTargetType target: _settings.targets.targets)
+		targets.emplace_back(ModelCheckerTargets::targetTypeToString.at(target));
+	settings["targets"] = std::move(targets);
+	settings["timeout"] = _settings.timeout ? Json(*_settings.timeout) : Json();
+	return settings;
+}
+
+/// @returns the versions of the enabled solvers that are linked into the compiler.
+Json solverVersions(smtutil::SMTSolverChoice const& _solvers)
+{
+	Json versions = Json::object();
+#ifdef HAVE_Z3
+	if (_solvers.z3 && smtutil::Z3Interface::available())
+		versions["z3"] = smtutil::Z3Interface::version();
+#else
+	(void)_solvers;
+#endif
+	return versions;
+}
+
+Json locationToJson(SourceLocation const& _location)
+{
+	Json location;
+	location["file"] = _location.sourceName ? Json(*_location.sourceName) : Json();
+	location["start"] = _location.start;
+	location["end"] = _location.end;
+	return location;
+}
+
+SourceLocation locationFromJson(Json const& _location)
+{
+	SourceLocation location;
+	if (_location.at("file").is_string())
+		location.sourceName = std::make_shared<std::string const>(_location.at("file").get<std::string>());
+	location.start = _location.at("start").get<int>();
+	location.end = _location.at("end").get<int>();
+	return location;
+}
+
+Json errorsToJson(ErrorList const& _errors)
+{
+	Json errors = Json::array();
+	for (auto const& error: _errors)
+	{
+		Json errorJson;
+		errorJson["id"] = error->errorId().error;
+		errorJson["type"] = Error::formatErrorType(error->type());
+		errorJson["message"] = error->comment() ? *error->comment() : "";
+		if (SourceLocation const* location = error->sourceLocation())
+			errorJson["sourceLocation"] = locationToJson(*location);
+		if (SecondarySourceLocation const* secondary = error->secondarySourceLocation())
+			for (auto const& [message, location]: secondary->infos)
+			{
+				Json info = locationToJson(location);
+				info["message"] = message;
+				errorJson["secondarySourceLocations"].emplace_back(std::move(info));
+			}
+		errors.emplace_back(std::move(errorJson));
+	}
+	return errors;
+}
+
+/// @returns nullopt if an error type is unknown.
+std::optional<ErrorList> errorsFromJson(Json const& _errors)
+{
+	ErrorList errors;
+	for (Json const& errorJson: _errors)
+	{
+		std::optional<Error::Type> type = Error::parseErrorType(errorJson.at("type").get<std::string>());
+		if (!type)
+			return std::nullopt;
+		SourceLocation location;
+		if (errorJson.contains("sourceLocation"))
+			location = locationFromJson(errorJson.at("sourceLocation"));
+		SecondarySourceLocation secondary;
+		if (errorJson.contains("secondarySourceLocations"))
+			for (Json const& info: errorJson.at("secondarySourceLocations"))
+				secondary.append(info.at("message").get<std::string>(), locationFromJson(info));
+		errors.emplace_back(std::make_shared<Error>(
+			ErrorId{errorJson.at("id").get<unsigned long long>()},
+			*type,
+			errorJson.at("message").get<std::string>(),
+			location,
+			secondary
+		));
+	}
+	return errors;
+}
+
+}
+
+bool ModelCheckerCache::canCache(ModelCheckerSettings const& _settings)
+{
+	// The smtlib2 solver answers queries from the responses given in the input, which are not part of the fingerprint.
+	// Eldarica and cvc5 are queried through the SMT callback and their results are not known to be deterministic.
+	// The statistics contain solving times.
+	return
+		!_settings.solvers.smtlib2 &&
+		!_settings.solvers.eld &&
+		!_settings.solvers.cvc5 &&
+		!_settings.printStats;
+}
+
+h256 ModelCheckerCache::fingerprint(
+	std::vector<std::shared_ptr<SourceUnit>> const& _sources,
+	ModelCheckerSettings const& _settings,
+	EVMVersion _evmVersion,
+	CharStreamProvider const& _charStreamProvider
+)
+{
+	// Sorted by name rather than by AST ID, since the IDs depend on the order in which the sources were given.
+	std::map<std::string, std::string const*> sources;
+	for (auto const& source: _sources)
+		if (source)
+		{
+			solAssert(source->location().sourceName);
+			std::string const& name = *source->location().sourceName;
+			sources[name] = &_charStreamProvider.charStream(name).source();
+		}
+
+	Json input;
+	input["version"] = VersionString;
+	input["evmVersion"] = _evmVersion.name();
+	input["settings"] = settingsToJson(_settings);
+	input["solverVersions"] = solverVersions(_settings.solvers);
+	Json sourceHashes = Json::object();
+	for (auto const& [name, content]: sources)
+		sourceHashes[name] = keccak256(*content).hex();
+	input["sources"] = std::move(sourceHashes);
+	return keccak256(jsonCompactPrint(input));
+}
+
+std::optional<ModelCheckerCache::Entry> ModelCheckerCache::load(h256 const& _fingerprint) const
+{
+	boost::filesystem::path path = entryPath(_fingerprint);
+	Json entryJson;
+	try
+	{
+		if (!boost::filesystem::is_regular_file(path) || !jsonParseStrict(readFileAsString(path), entryJson))
+			return std::nullopt;
+		std::optional<ErrorList> errors = errorsFromJson(entryJson.at("errors"));
+		if (!errors)
+			return std::nullopt;
+		return Entry{std::move(*errors)};
+	}
+	catch (...)
+	{
+		// Unreadable or outdated entries are treated as missing and overwritten after the analysis.
+		return std::nullopt;
+	}
+}
+
+bool ModelCheckerCache::store(h256 const& _fingerprint, Entry const& _entry) const
+{
+	Json entryJson;
+	entryJson["errors"] = errorsToJson(_entry.errors);
+
+	boost::system::error_code errorCode;
+	boost::filesystem::create_directories(m_directory, errorCode);
+	if (errorCode)
+		return false;
+
+	// Write to a unique temporary file first, so that concurrent compilations never read a partial entry.
+	boost::filesystem::path path = entryPath(_fingerprint);
+	boost::filesystem::path temporaryPath = path;
+	temporaryPath += boost::filesystem::unique_path(".%%%%-%%%%-%%%%.tmp");
+	{
+		std::ofstream file(temporaryPath.string(), std::ios::binary | std::ios::trunc);
+		file << jsonCompactPrint(entryJson);
+		if (!file)
+		{
+			file.close();
+			boost::filesystem::remove(temporaryPath, errorCode);
+			return false;
+		}
+	}
+	boost::filesystem::rename(temporaryPath, path, errorCode);
+	if (errorCode)
+	{
+		boost::filesystem::remove(temporaryPath, errorCode);
+		return false;
+	}
+	return true;
+}
+
+boost::filesystem::path ModelCheckerCache::entryPath(h256 const& _fingerprint) const
+{
+	return m_directory / (_fingerprint.hex() + ".json");
+}
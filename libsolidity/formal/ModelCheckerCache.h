@@ -0,0 +1,95 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * On-disk store of the diagnostics that the model checker produced for a compilation,
+ * so that unchanged sources are not verified again.
+ */
+
+#pragma once
+
+#include <libsolidity/formal/ModelCheckerSettings.h>
+
+#include <liblangutil/EVMVersion.h>
+#include <liblangutil/Exceptions.h>
+
+#include <libsolutil/FixedHash.h>
+
+#include <boost/filesystem/path.hpp>
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace solidity::langutil
+{
+class CharStreamProvider;
+}
+
+namespace solidity::frontend
+{
+
+class SourceUnit;
+
+/**
+ * Maps fingerprints of compilations to the warnings and infos that the model checker reported for them.
+ *
+ * The engines share the targets they already solved and their summary messages across the source units
+ * of a compilation, so the results of a source unit depend on the ones analyzed before it.
+ * Entries are therefore stored for the whole compilation rather than per source unit.
+ * The fingerprint covers the compiler version, the EVM version, the solver versions,
+ * the settings that influence the results and the names and contents of all source units.
+ * Every entry is stored as a separate JSON file in the cache directory.
+ */
+class ModelCheckerCache
+{
+public:
+	struct Entry
+	{
+		/// All diagnostics of the model checker, in the order in which they were reported.
+		langutil::ErrorList errors;
+	};
+
+	explicit ModelCheckerCache(boost::filesystem::path _directory): m_directory(std::move(_directory)) {}
+
+	/// @returns true if the results of the engines only depend on what the fingerprint covers.
+	/// This is not the case if the results depend on the given SMT-LIB2 responses or on solvers
+	/// queried through the SMT callback, whose results are not known to be deterministic.
+	static bool canCache(ModelCheckerSettings const& _settings);
+
+	static util::h256 fingerprint(
+		std::vector<std::shared_ptr<SourceUnit>> const& _sources,
+		ModelCheckerSettings const& _settings,
+		langutil::EVMVersion _evmVersion,
+		langutil::CharStreamProvider const& _charStreamProvider
+	);
+
+	/// @returns the stored entry or nullopt if there is none or it cannot be read.
+	std::optional<Entry> load(util::h256 const& _fingerprint) const;
+
+	/// Stores @a _entry, replacing an existing one.
+	/// @returns false if the entry could not be written.
+	bool store(util::h256 const& _fingerprint, Entry const& _entry) const;
+
+private:
+	boost::filesystem::path entryPath(util::h256 const& _fingerprint) const;
+
+	boost::filesystem::path m_directory;
+};
+
+}
@@ -158,6 +158,9 @@ struct ModelCheckerExtCalls
 struct ModelCheckerSettings
 {
 	std::optional<unsigned> bmcLoopIterations;
+	/// Directory in which the results of the engines are stored per source unit fingerprint.
+	/// Source units whose fingerprint is already stored are not analyzed again.
+	std::optional<std::string> cacheDirectory;
 	ModelCheckerContracts contracts = ModelCheckerContracts::Default();
 	/// Currently division and modulo are replaced by multiplication with slack vars, such that
 	/// a / b <=> a = b * k + m
@@ -169,7 +172,13 @@ struct ModelCheckerSettings
 	ModelCheckerEngine engine = ModelCheckerEngine::None();
 	ModelCheckerExtCalls externalCalls = {};
 	ModelCheckerInvariants invariants = ModelCheckerInvariants::Default();
+	/// Number of solver instances that CHC uses to discharge verification targets and BMC uses
+	/// to discharge the verification conditions of a function concurrently.
+	/// With the default of 1 all targets are queried one after another on a single solver instance.
+	unsigned jobs = 1;
 	bool printQuery = false;
+	/// Reports the size, solving time and result of every CHC query as JSON.
+	bool printStats = false;
 	bool showProvedSafe = false;
 	bool showUnproved = false;
 	bool showUnsupported = false;
@@ -182,12 +191,15 @@ struct ModelCheckerSettings
 	{
 		return
 			bmcLoopIterations == _other.bmcLoopIterations &&
+			cacheDirectory == _other.cacheDirectory &&
 			contracts == _other.contracts &&
 			divModNoSlacks == _other.divModNoSlacks &&
 			engine == _other.engine &&
 			externalCalls.mode == _other.externalCalls.mode &&
 			invariants == _other.invariants &&
+			jobs == _other.jobs &&
 			printQuery == _other.printQuery &&
+			printStats == _other.printStats &&
 			showProvedSafe == _other.showProvedSafe &&
 			showUnproved == _other.showUnproved &&
 			showUnsupported == _other.showUnsupported &&
@@ -55,6 +55,7 @@
 #include <libsolidity/interface/StorageLayout.h>
 #include <libsolidity/interface/UniversalCallback.h>
 #include <libsolidity/interface/Version.h>
+#include <libsolidity/parsing/ConcurrentParser.h>
 #include <libsolidity/parsing/Parser.h>
 
 #include <libsolidity/experimental/analysis/Analysis.h>
@@ -94,6 +95,8 @@
 #include <fmt/format.h>
 
 #include <utility>
+#include <atomic>
+#include <future>
 #include <map>
 #include <limits>
 #include <string>
@@ -249,6 +252,21 @@ void CompilerStack::setModelCheckerSettings(ModelCheckerSettings _settings)
 	m_modelCheckerSettings = _settings;
 }
 
+void CompilerStack::setJobs(size_t _jobs)
+{
+	solAssert(m_stackState < ParsedAndImported, "Must set the number of jobs before parsing.");
+	solAssert(_jobs > 0, "The number of jobs must be positive.");
+	solAssert(_jobs <= c_maxJobs, "The number of jobs must not exceed " + std::to_string(c_maxJobs) + ".");
+	m_jobs = _jobs;
+}
+
+void CompilerStack::setGasEstimationMaxPaths(size_t _maxPaths)
+{
+	solAssert(m_stackState < ParsedAndImported, "Must set the gas estimation limit before parsing.");
+	solAssert(_maxPaths > 0, "The maximum number of paths must be positive.");
+	m_gasEstimationMaxPaths = _maxPaths;
+}
+
 void CompilerStack::setLibraries(std::map<std::string, util::h160> const& _libraries)
 {
 	solAssert(m_stackState < ParsedAndImported, "Must set libraries before parsing.");
@@ -313,6 +331,8 @@ void CompilerStack::reset(bool _keepSettings)
 		m_viaIR = false;
 		m_evmVersion = langutil::EVMVersion();
 		m_modelCheckerSettings = ModelCheckerSettings{};
+		m_jobs = 1;
+		m_gasEstimationMaxPaths = std::numeric_limits<size_t>::max();
 		m_generateIR = false;
 		m_revertStrings = RevertStrings::Default;
 		m_optimiserSettings = OptimiserSettings::minimal();
@@ -320,12 +340,14 @@ void CompilerStack::reset(bool _keepSettings)
 		m_metadataFormat = defaultMetadataFormat();
 		m_metadataHash = MetadataHash::IPFS;
 		m_stopAfter = State::CompilationSuccessful;
+		m_timings.enable(false);
 	}
 	m_experimentalAnalysis.reset();
 	m_globalContext.reset();
 	m_sourceOrder.clear();
 	m_contracts.clear();
 	m_errorReporter.clear();
+	m_timings.clear();
 	TypeProvider::reset();
 }
 
@@ -341,6 +363,7 @@ void CompilerStack::setSources(StringMap _sources)
 bool CompilerStack::parse()
 {
 	solAssert(m_stackState == SourcesSet, "Must call parse only after the SourcesSet state.");
+	CompilerTimings::ScopedTimer timer{m_timings, "parsing"};
 	m_errorReporter.clear();
 
 	if (SemVerVersion{std::string(VersionString)}.isPrerelease())
@@ -349,16 +372,29 @@ bool CompilerStack::parse()
 	try
 	{
 		Parser parser{m_errorReporter, m_evmVersion};
+		// Parses the sources ahead on worker threads, while imports are resolved and loaded
+		// on this thread in the same order as with a single parser.
+		std::unique_ptr<ConcurrentParser> concurrentParser;
+		if (m_jobs > 1)
+			concurrentParser = std::make_unique<ConcurrentParser>(m_evmVersion, m_jobs);
 
 		std::vector<std::string> sourcesToParse;
+		auto addSourceToParse = [&](std::string const& _path) {
+			sourcesToParse.push_back(_path);
+			if (concurrentParser)
+				concurrentParser->add(m_sources[_path].charStream);
+		};
 		for (auto const& s: m_sources)
-			sourcesToParse.push_back(s.first);
+			addSourceToParse(s.first);
 
 		for (size_t i = 0; i < sourcesToParse.size(); ++i)
 		{
 			std::string const& path = sourcesToParse[i];
 			Source& source = m_sources[path];
-			source.ast = parser.parse(*source.charStream);
+			if (concurrentParser)
+				source.ast = concurrentParser->takeNext(m_errorReporter);
+			else
+				source.ast = parser.parse(*source.charStream);
 			if (!source.ast)
 				solAssert(Error::containsErrors(m_errorReporter.errors()), "Parser returned null but did not report error.");
 			else
@@ -375,7 +411,7 @@ bool CompilerStack::parse()
 					{
 						auto [name, content] = *it;
 						m_sources[name].charStream = std::make_unique<CharStream>(content, name);
-						sourcesToParse.push_back(name);
+						addSourceToParse(name);
 					}
 
 					// The current value of `path` is the absolute path as seen from this source file.
@@ -393,7 +429,7 @@ bool CompilerStack::parse()
 						std::string const& newPath = newSource.first;
 						std::string const& newContents = newSource.second;
 						m_sources[newPath].charStream = std::make_shared<CharStream>(newContents, newPath);
-						sourcesToParse.push_back(newPath);
+						addSourceToParse(newPath);
 					}
 			}
 		}
@@ -405,7 +441,7 @@ bool CompilerStack::parse()
 		storeContractDefinitions();
 
 		solAssert(!m_maxAstId.has_value());
-		m_maxAstId = parser.maxID();
+		m_maxAstId = concurrentParser ? concurrentParser->maxID() : parser.maxID();
 	}
 	catch (UnimplementedFeatureError const& _error)
 	{
@@ -418,6 +454,7 @@ bool CompilerStack::parse()
 void CompilerStack::importASTs(std::map<std::string, Json> const& _sources)
 {
 	solAssert(m_stackState == Empty, "Must call importASTs only before the SourcesSet state.");
+	CompilerTimings::ScopedTimer timer{m_timings, "importASTs"};
 	std::map<std::string, ASTPointer<SourceUnit>> reconstructedSources = ASTJsonImporter(m_evmVersion).jsonToSourceUnit(_sources);
 	for (auto& src: reconstructedSources)
 	{
@@ -441,6 +478,7 @@ void CompilerStack::importASTs(std::map<std::string, Json> const& _sources)
 bool CompilerStack::analyze()
 {
 	solAssert(m_stackState == ParsedAndImported, "Must call analyze only after parsing was successful.");
+	CompilerTimings::ScopedTimer timer{m_timings, "analysis"};
 
 	if (!resolveImports())
 		return false;
@@ -455,38 +493,48 @@ bool CompilerStack::analyze()
 	{
 		bool experimentalSolidity = isExperimentalSolidity();
 
-		SyntaxChecker syntaxChecker(m_errorReporter, m_optimiserSettings.runYulOptimiser);
-		for (Source const* source: m_sourceOrder)
-			if (source->ast && !syntaxChecker.checkSyntax(*source->ast))
+		{
+			CompilerTimings::ScopedTimer timer{m_timings, "analysis.syntaxChecker"};
+			if (!checkSourcesConcurrently([&](SourceUnit const& _source, ErrorReporter& _errorReporter) {
+				return SyntaxChecker(_errorReporter, m_optimiserSettings.runYulOptimiser).checkSyntax(_source);
+			}))
 				noErrors = false;
+		}
 
 		m_globalContext = std::make_shared<GlobalContext>(m_evmVersion);
 		// We need to keep the same resolver during the whole process.
 		NameAndTypeResolver resolver(*m_globalContext, m_evmVersion, m_errorReporter, experimentalSolidity);
-		for (Source const* source: m_sourceOrder)
-			if (source->ast && !resolver.registerDeclarations(*source->ast))
-				return false;
+		{
+			CompilerTimings::ScopedTimer timer{m_timings, "analysis.registerDeclarations"};
+			for (Source const* source: m_sourceOrder)
+				if (source->ast && !resolver.registerDeclarations(*source->ast))
+					return false;
 
-		std::map<std::string, SourceUnit const*> sourceUnitsByName;
-		for (auto& source: m_sources)
-			sourceUnitsByName[source.first] = source.second.ast.get();
-		for (Source const* source: m_sourceOrder)
-			if (source->ast && !resolver.performImports(*source->ast, sourceUnitsByName))
-				return false;
+			std::map<std::string, SourceUnit const*> sourceUnitsByName;
+			for (auto& source: m_sources)
+				sourceUnitsByName[source.first] = source.second.ast.get();
+			for (Source const* source: m_sourceOrder)
+				if (source->ast && !resolver.performImports(*source->ast, sourceUnitsByName))
+					return false;
 
-		resolver.warnHomonymDeclarations();
+			resolver.warnHomonymDeclarations();
+		}
 
 		{
-			DocStringTagParser docStringTagParser(m_errorReporter);
-			for (Source const* source: m_sourceOrder)
-				if (source->ast && !docStringTagParser.parseDocStrings(*source->ast))
-					noErrors = false;
+			CompilerTimings::ScopedTimer timer{m_timings, "analysis.docStringTagParser"};
+			if (!checkSourcesConcurrently([](SourceUnit const& _source, ErrorReporter& _errorReporter) {
+				return DocStringTagParser(_errorReporter).parseDocStrings(_source);
+			}))
+				noErrors = false;
 		}
 
 		// Requires DocStringTagParser
-		for (Source const* source: m_sourceOrder)
-			if (source->ast && !resolver.resolveNamesAndTypes(*source->ast))
-				return false;
+		{
+			CompilerTimings::ScopedTimer timer{m_timings, "analysis.nameAndTypeResolver"};
+			for (Source const* source: m_sourceOrder)
+				if (source->ast && !resolver.resolveNamesAndTypes(*source->ast))
+					return false;
+		}
 
 		if (experimentalSolidity)
 		{
@@ -519,26 +567,35 @@ bool CompilerStack::analyzeLegacy(bool _noErrorsSoFar)
 {
 	bool noErrors = _noErrorsSoFar;
 
-	DeclarationTypeChecker declarationTypeChecker(m_errorReporter, m_evmVersion);
-	for (Source const* source: m_sourceOrder)
-		if (source->ast && !declarationTypeChecker.check(*source->ast))
-			return false;
+	{
+		CompilerTimings::ScopedTimer timer{m_timings, "analysis.declarationTypeChecker"};
+		DeclarationTypeChecker declarationTypeChecker(m_errorReporter, m_evmVersion);
+		for (Source const* source: m_sourceOrder)
+			if (source->ast && !declarationTypeChecker.check(*source->ast))
+				return false;
+	}
 
 	// Requires DeclarationTypeChecker to have run
-	DocStringTagParser docStringTagParser(m_errorReporter);
-	for (Source const* source: m_sourceOrder)
-		if (source->ast && !docStringTagParser.validateDocStringsUsingTypes(*source->ast))
-			noErrors = false;
+	{
+		CompilerTimings::ScopedTimer timer{m_timings, "analysis.docStringTagParser"};
+		DocStringTagParser docStringTagParser(m_errorReporter);
+		for (Source const* source: m_sourceOrder)
+			if (source->ast && !docStringTagParser.validateDocStringsUsingTypes(*source->ast))
+				noErrors = false;
+	}
 
 	// Next, we check inheritance, overrides, function collisions and other things at
 	// contract or function level.
 	// This also calculates whether a contract is abstract, which is needed by the
 	// type checker.
-	ContractLevelChecker contractLevelChecker(m_errorReporter);
+	{
+		CompilerTimings::ScopedTimer timer{m_timings, "analysis.contractLevelChecker"};
+		ContractLevelChecker contractLevelChecker(m_errorReporter);
 
-	for (Source const* source: m_sourceOrder)
-		if (auto sourceAst = source->ast)
-			noErrors = contractLevelChecker.check(*sourceAst);
+		for (Source const* source: m_sourceOrder)
+			if (auto sourceAst = source->ast)
+				noErrors = contractLevelChecker.check(*sourceAst);
+	}
 
 	// Now we run full type checks that go down to the expression level. This
 	// cannot be done earlier, because we need cross-contract types and information
@@ -547,14 +604,18 @@ bool CompilerStack::analyzeLegacy(bool _noErrorsSoFar)
 	//
 	// Note: this does not resolve overloaded functions. In order to do that, types of arguments are needed,
 	// which is only done one step later.
-	TypeChecker typeChecker(m_evmVersion, m_errorReporter);
-	for (Source const* source: m_sourceOrder)
-		if (source->ast && !typeChecker.checkTypeRequirements(*source->ast))
-			noErrors = false;
+	{
+		CompilerTimings::ScopedTimer timer{m_timings, "analysis.typeChecker"};
+		TypeChecker typeChecker(m_evmVersion, m_errorReporter);
+		for (Source const* source: m_sourceOrder)
+			if (source->ast && !typeChecker.checkTypeRequirements(*source->ast))
+				noErrors = false;
+	}
 
 	if (noErrors)
 	{
 		// Requires ContractLevelChecker and TypeChecker
+		CompilerTimings::ScopedTimer timer{m_timings, "analysis.docStringAnalyser"};
 		DocStringAnalyser docStringAnalyser(m_errorReporter);
 		for (Source const* source: m_sourceOrder)
 			if (source->ast && !docStringAnalyser.analyseDocStrings(*source->ast))
@@ -564,6 +625,7 @@ bool CompilerStack::analyzeLegacy(bool _noErrorsSoFar)
 	if (noErrors)
 	{
 		// Checks that can only be done when all types of all AST nodes are known.
+		CompilerTimings::ScopedTimer timer{m_timings, "analysis.postTypeChecker"};
 		PostTypeChecker postTypeChecker(m_errorReporter);
 		for (Source const* source: m_sourceOrder)
 			if (source->ast && !postTypeChecker.check(*source->ast))
@@ -575,29 +637,37 @@ bool CompilerStack::analyzeLegacy(bool _noErrorsSoFar)
 	// Create & assign callgraphs and check for contract dependency cycles
 	if (noErrors)
 	{
+		CompilerTimings::ScopedTimer timer{m_timings, "analysis.callGraph"};
 		createAndAssignCallGraphs();
 		annotateInternalFunctionIDs();
 		findAndReportCyclicContractDependencies();
 	}
 
 	if (noErrors)
+	{
+		CompilerTimings::ScopedTimer timer{m_timings, "analysis.postTypeContractLevelChecker"};
 		for (Source const* source: m_sourceOrder)
 			if (source->ast && !PostTypeContractLevelChecker{m_errorReporter}.check(*source->ast))
 				noErrors = false;
+	}
 
 	// Check that immutable variables are never read in c'tors and assigned
 	// exactly once
 	if (noErrors)
-		for (Source const* source: m_sourceOrder)
-			if (source->ast)
-				for (ASTPointer<ASTNode> const& node: source->ast->nodes())
-					if (ContractDefinition* contract = dynamic_cast<ContractDefinition*>(node.get()))
-						ImmutableValidator(m_errorReporter, *contract).analyze();
+	{
+		CompilerTimings::ScopedTimer timer{m_timings, "analysis.immutableValidator"};
+		checkSourcesConcurrently([](SourceUnit const& _source, ErrorReporter& _errorReporter) {
+			for (ContractDefinition const* contract: ASTNode::filteredNodes<ContractDefinition>(_source.nodes()))
+				ImmutableValidator(_errorReporter, *contract).analyze();
+			return true;
+		});
+	}
 
 	if (noErrors)
 	{
 		// Control flow graph generator and analyzer. It can check for issues such as
 		// variable is used before it is assigned to.
+		CompilerTimings::ScopedTimer timer{m_timings, "analysis.controlFlowAnalyzer"};
 		CFG cfg(m_errorReporter);
 		for (Source const* source: m_sourceOrder)
 			if (source->ast && !cfg.constructFlow(*source->ast))
@@ -617,6 +687,7 @@ bool CompilerStack::analyzeLegacy(bool _noErrorsSoFar)
 	if (noErrors)
 	{
 		// Checks for common mistakes. Only generates warnings.
+		CompilerTimings::ScopedTimer timer{m_timings, "analysis.staticAnalyzer"};
 		StaticAnalyzer staticAnalyzer(m_errorReporter);
 		for (Source const* source: m_sourceOrder)
 			if (source->ast && !staticAnalyzer.analyze(*source->ast))
@@ -626,6 +697,7 @@ bool CompilerStack::analyzeLegacy(bool _noErrorsSoFar)
 	if (noErrors)
 	{
 		// Check for state mutability in every function.
+		CompilerTimings::ScopedTimer timer{m_timings, "analysis.viewPureChecker"};
 		std::vector<ASTPointer<ASTNode>> ast;
 		for (Source const* source: m_sourceOrder)
 			if (source->ast)
@@ -638,6 +710,7 @@ bool CompilerStack::analyzeLegacy(bool _noErrorsSoFar)
 	if (noErrors)
 	{
 		// Run SMTChecker
+		CompilerTimings::ScopedTimer timer{m_timings, "analysis.modelChecker"};
 
 		auto allSources = util::applyMap(m_sourceOrder, [](Source const* _source) { return _source->ast; });
 		if (ModelChecker::isPragmaPresent(allSources))
@@ -648,21 +721,78 @@ bool CompilerStack::analyzeLegacy(bool _noErrorsSoFar)
 		if (m_modelCheckerSettings.engine.any())
 			m_modelCheckerSettings.solvers = ModelChecker::checkRequestedSolvers(m_modelCheckerSettings.solvers, m_errorReporter);
 
-		ModelChecker modelChecker(m_errorReporter, *this, m_smtlib2Responses, m_modelCheckerSettings, m_readFile);
+		ModelChecker modelChecker(m_errorReporter, *this, m_smtlib2Responses, m_modelCheckerSettings, m_readFile, m_evmVersion);
 		modelChecker.checkRequestedSourcesAndContracts(allSources);
-		for (Source const* source: m_sourceOrder)
-			if (source->ast)
-				modelChecker.analyze(*source->ast);
+		modelChecker.analyze(allSources);
 		m_unhandledSMTLib2Queries += modelChecker.unhandledQueries();
 	}
 
 	return noErrors;
 }
 
+bool CompilerStack::checkSourcesConcurrently(std::function<bool(SourceUnit const&, ErrorReporter&)> const& _check)
+{
+	std::vector<SourceUnit const*> sources;
+	for (Source const* source: m_sourceOrder)
+		if (source->ast)
+			sources.push_back(source->ast.get());
+
+	bool success = true;
+	if (m_jobs <= 1 || sources.size() <= 1)
+	{
+		for (SourceUnit const* source: sources)
+			if (!_check(*source, m_errorReporter))
+				success = false;
+		return success;
+	}
+
+	struct Result
+	{
+		ErrorList errors;
+		bool success = true;
+		std::exception_ptr exception;
+	};
+	std::vector<Result> results(sources.size());
+	std::atomic<size_t> nextSource = 0;
+	auto work = [&]() {
+		for (size_t index = nextSource++; index < sources.size(); index = nextSource++)
+		{
+			Result& result = results[index];
+			ErrorReporter errorReporter(result.errors);
+			try
+			{
+				result.success = _check(*sources[index], errorReporter);
+			}
+			catch (...)
+			{
+				result.exception = std::current_exception();
+			}
+		}
+	};
+	std::vector<std::future<void>> workers;
+	for (size_t i = 1; i < std::min(m_jobs, sources.size()); ++i)
+		workers.emplace_back(std::async(std::launch::async, work));
+	work();
+	for (std::future<void>& worker: workers)
+		worker.get();
+
+	// A fatal error stops the check, so the errors of the later source units are dropped.
+	for (Result const& result: results)
+	{
+		m_errorReporter.append(result.errors);
+		if (result.exception)
+			std::rethrow_exception(result.exception);
+		if (!result.success)
+			success = false;
+	}
+	return success;
+}
+
 bool CompilerStack::analyzeExperimental()
 {
 	solAssert(!m_experimentalAnalysis);
 	solAssert(m_maxAstId && *m_maxAstId >= 0);
+	CompilerTimings::ScopedTimer timer{m_timings, "analysis.experimental"};
 	m_experimentalAnalysis = std::make_unique<experimental::Analysis>(m_errorReporter, static_cast<std::uint64_t>(*m_maxAstId));
 	std::vector<std::shared_ptr<SourceUnit const>> sourceAsts;
 	for (Source const* source: m_sourceOrder)
@@ -718,6 +848,8 @@ bool CompilerStack::compile(State _stopAfter)
 	if (m_stackState >= m_stopAfter)
 		return true;
 
+	CompilerTimings::ScopedTimer timer{m_timings, "compilation"};
+
 	// Only compile contracts individually which have been requested.
 	std::map<ContractDefinition const*, std::shared_ptr<Compiler const>> otherCompilers;
 
@@ -763,6 +895,7 @@ bool CompilerStack::compile(State _stopAfter)
 void CompilerStack::link()
 {
 	solAssert(m_stackState >= CompilationSuccessful, "");
+	CompilerTimings::ScopedTimer timer{m_timings, "link"};
 	for (auto& contract: m_contracts)
 	{
 		contract.second.object.link(m_libraries);
@@ -1183,6 +1316,7 @@ std::string CompilerStack::applyRemapping(std::string const& _path, std::string
 bool CompilerStack::resolveImports()
 {
 	solAssert(m_stackState == ParsedAndImported, "");
+	CompilerTimings::ScopedTimer timer{m_timings, "resolveImports"};
 
 	// topological sorting (depth first search) of the import graph, cutting potential cycles
 	std::vector<Source const*> sourceOrder;
@@ -1303,6 +1437,7 @@ void CompilerStack::assembleYul(
 	solAssert(m_stackState >= AnalysisSuccessful, "");
 
 	Contract& compiledContract = m_contracts.at(_contract.fullyQualifiedName());
+	CompilerTimings::ScopedTimer timer{m_timings, "assemble", _contract.fullyQualifiedName()};
 
 	compiledContract.evmAssembly = _assembly;
 	solAssert(compiledContract.evmAssembly, "");
@@ -1386,14 +1521,17 @@ void CompilerStack::compileContract(
 
 	Contract& compiledContract = m_contracts.at(_contract.fullyQualifiedName());
 
-	std::shared_ptr<Compiler> compiler = std::make_shared<Compiler>(m_evmVersion, m_revertStrings, m_optimiserSettings);
+	std::shared_ptr<Compiler> compiler = std::make_shared<Compiler>(m_evmVersion, m_revertStrings, m_optimiserSettings, m_jobs);
 	compiledContract.compiler = compiler;
 
 	solAssert(!m_viaIR, "");
 	bytes cborEncodedMetadata = createCBORMetadata(compiledContract, /* _forIR */ false);
 
 	// Run optimiser and compile the contract.
-	compiler->compileContract(_contract, _otherCompilers, cborEncodedMetadata);
+	{
+		CompilerTimings::ScopedTimer timer{m_timings, "legacyCodegen", _contract.fullyQualifiedName()};
+		compiler->compileContract(_contract, _otherCompilers, cborEncodedMetadata);
+	}
 
 	_otherCompilers[compiledContract.contract] = compiler;
 
@@ -1429,6 +1567,7 @@ void CompilerStack::generateIR(ContractDefinition const& _contract)
 
 	if (m_experimentalAnalysis)
 	{
+		CompilerTimings::ScopedTimer timer{m_timings, "generateIR", _contract.fullyQualifiedName()};
 		experimental::IRGenerator generator(
 			m_evmVersion,
 			m_eofVersion,
@@ -1446,6 +1585,7 @@ void CompilerStack::generateIR(ContractDefinition const& _contract)
 	}
 	else
 	{
+		CompilerTimings::ScopedTimer timer{m_timings, "generateIR", _contract.fullyQualifiedName()};
 		IRGenerator generator(
 			m_evmVersion,
 			m_eofVersion,
@@ -1478,7 +1618,10 @@ void CompilerStack::generateIR(ContractDefinition const& _contract)
 	);
 
 	compiledContract.yulIRAst = stack.astJson();
-	stack.optimize();
+	{
+		CompilerTimings::ScopedTimer timer{m_timings, "optimizeIR", _contract.fullyQualifiedName()};
+		stack.optimize();
+	}
 	compiledContract.yulIROptimized = stack.print(this);
 	compiledContract.yulIROptimizedAst = stack.astJson();
 }
@@ -1495,13 +1638,16 @@ void CompilerStack::generateEVMFromIR(ContractDefinition const& _contract)
 	if (!compiledContract.object.bytecode.empty())
 		return;
 
+	CompilerTimings::ScopedTimer timer{m_timings, "generateEVMFromIR", _contract.fullyQualifiedName()};
+
 	// Re-parse the Yul IR in EVM dialect
 	yul::YulStack stack(
 		m_evmVersion,
 		m_eofVersion,
 		yul::YulStack::Language::StrictAssembly,
 		m_optimiserSettings,
-		m_debugInfoSelection
+		m_debugInfoSelection,
+		m_jobs
 	);
 	bool analysisSuccessful = stack.parseAndAnalyze("", compiledContract.yulIROptimized);
 	solAssert(analysisSuccessful);
@@ -1555,6 +1701,7 @@ CompilerStack::Source const& CompilerStack::source(std::string const& _sourceNam
 
 std::string CompilerStack::createMetadata(Contract const& _contract, bool _forIR) const
 {
+	CompilerTimings::ScopedTimer timer{m_timings, "metadata", _contract.contract->fullyQualifiedName()};
 	Json meta;
 	meta["version"] = 1;
 	std::string sourceType;
@@ -1821,7 +1968,7 @@ Json CompilerStack::gasEstimates(std::string const& _contractName) const
 		return Json();
 
 	using Gas = GasEstimator::GasConsumption;
-	GasEstimator gasEstimator(m_evmVersion);
+	GasEstimator gasEstimator(m_evmVersion, m_gasEstimationMaxPaths);
 	Json output = Json::object();
 
 	if (evmasm::AssemblyItems const* items = assemblyItems(_contractName))
@@ -1840,20 +1987,22 @@ Json CompilerStack::gasEstimates(std::string const& _contractName) const
 
 	if (evmasm::AssemblyItems const* items = runtimeAssemblyItems(_contractName))
 	{
+		evmasm::PathGasMeter meter = gasEstimator.pathGasMeter(*items);
+
 		/// External functions
 		ContractDefinition const& contract = contractDefinition(_contractName);
 		Json externalFunctions = Json::object();
 		for (auto it: contract.interfaceFunctions())
 		{
 			std::string sig = it.second->externalSignature();
-			externalFunctions[sig] = gasToJson(gasEstimator.functionalEstimation(*items, sig));
+			externalFunctions[sig] = gasToJson(gasEstimator.functionalEstimation(meter, sig));
 		}
 
 		if (contract.fallbackFunction())
 			/// This needs to be set to an invalid signature in order to trigger the fallback,
 			/// without the shortcut (of CALLDATSIZE == 0), and therefore to receive the upper bound.
 			/// An empty string ("") would work to trigger the shortcut only.
-			externalFunctions[""] = gasToJson(gasEstimator.functionalEstimation(*items, "INVALID"));
+			externalFunctions[""] = gasToJson(gasEstimator.functionalEstimation(meter, "INVALID"));
 
 		if (!externalFunctions.empty())
 			output["external"] = externalFunctions;
@@ -1869,7 +2018,7 @@ Json CompilerStack::gasEstimates(std::string const& _contractName) const
 			size_t entry = functionEntryPoint(_contractName, *it);
 			GasEstimator::GasConsumption gas = GasEstimator::GasConsumption::infinite();
 			if (entry > 0)
-				gas = gasEstimator.functionalEstimation(*items, entry, *it);
+				gas = gasEstimator.functionalEstimation(meter, entry, *it);
 
 			/// TODO: This could move into a method shared with externalSignature()
 			FunctionType type(*it);
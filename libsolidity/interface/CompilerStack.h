@@ -25,6 +25,7 @@
 #pragma once
 
 #include <libsolidity/analysis/FunctionCallGraph.h>
+#include <libsolidity/interface/CompilerTimings.h>
 #include <libsolidity/interface/ReadFile.h>
 #include <libsolidity/interface/ImportRemapper.h>
 #include <libsolidity/interface/OptimiserSettings.h>
@@ -50,6 +51,7 @@
 #include <libsolutil/JSON.h>
 
 #include <functional>
+#include <limits>
 #include <memory>
 #include <ostream>
 #include <set>
@@ -94,6 +96,9 @@ class Analysis;
 class CompilerStack: public langutil::CharStreamProvider, public evmasm::AbstractAssemblyStack
 {
 public:
+	/// Upper bound of the number of jobs, so that user input cannot request more threads than the system can start.
+	static size_t constexpr c_maxJobs = 256;
+
 	/// Noncopyable.
 	CompilerStack(CompilerStack const&) = delete;
 	CompilerStack& operator=(CompilerStack const&) = delete;
@@ -180,6 +185,15 @@ public:
 	/// Set model checker settings.
 	void setModelCheckerSettings(ModelCheckerSettings _settings);
 
+	/// Set the number of threads used to parse and analyze the sources and by the evmasm optimiser.
+	/// The default is 1 and the maximum is c_maxJobs. The read callback is still only invoked from the calling
+	/// thread and the AST, including the node IDs, the errors and the bytecode are the same for every number of jobs.
+	void setJobs(size_t _jobs);
+
+	/// Set the maximum number of paths the gas estimator explores per function. The gas estimate
+	/// of a function with more paths is infinite. The default is no limit.
+	void setGasEstimationMaxPaths(size_t _maxPaths);
+
 	/// Sets the requested contract names by source.
 	/// If empty, no filtering is performed and every contract
 	/// found in the supplied sources is compiled.
@@ -195,6 +209,13 @@ public:
 	/// Enable generation of Yul IR code.
 	void enableIRGeneration(bool _enable = true) { m_generateIR = _enable; }
 
+	/// Enable recording of wall time and peak memory usage per compiler phase.
+	void enableTimings(bool _enable = true) { m_timings.enable(_enable); }
+
+	/// @returns the wall time and peak memory usage of the compiler phases that ran so far.
+	/// Only filled if enabled via enableTimings().
+	CompilerTimings const& timings() const { return m_timings; }
+
 	/// @arg _metadataLiteralSources When true, store sources as literals in the contract metadata.
 	/// Must be set before parsing.
 	void useMetadataLiteralSources(bool _metadataLiteralSources);
@@ -428,6 +449,14 @@ private:
 	/// @returns false on error.
 	bool analyzeLegacy(bool _noErrorsSoFar);
 
+	/// Runs @a _check on every source unit, concurrently on up to m_jobs threads.
+	/// Only suitable for checks that do not modify anything outside of the given source unit
+	/// and that do not create types, as the TypeProvider is not thread-safe.
+	/// Every source unit reports to its own error list. The lists are appended in the order of
+	/// m_sourceOrder, which results in the same errors as running the checks one after another.
+	/// @returns false if the check failed for any source unit.
+	bool checkSourcesConcurrently(std::function<bool(SourceUnit const&, langutil::ErrorReporter&)> const& _check);
+
 	/// Perform the analysis steps of experimental language mode.
 	/// @returns false on error.
 	bool analyzeExperimental();
@@ -513,6 +542,8 @@ private:
 	langutil::EVMVersion m_evmVersion;
 	std::optional<uint8_t> m_eofVersion;
 	ModelCheckerSettings m_modelCheckerSettings;
+	size_t m_jobs = 1;
+	size_t m_gasEstimationMaxPaths = std::numeric_limits<size_t>::max();
 	std::map<std::string, std::set<std::string>> m_requestedContractNames;
 	bool m_generateEvmBytecode = true;
 	bool m_generateIR = false;
@@ -535,6 +566,8 @@ private:
 	State m_stackState = Empty;
 	CompilationSourceType m_compilationSourceType = CompilationSourceType::Solidity;
 	MetadataFormat m_metadataFormat = defaultMetadataFormat();
+	/// Mutable because metadata and other artifacts are created lazily by const accessors.
+	CompilerTimings mutable m_timings;
 };
 
 }
@@ -0,0 +1,107 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+#include <libsolidity/interface/CompilerTimings.h>
+
+#include <fmt/format.h>
+
+#include <algorithm>
+
+#if defined(__linux) || defined(__APPLE__)
+#include <sys/resource.h>
+#endif
+
+using namespace solidity;
+using namespace solidity::frontend;
+
+CompilerTimings::ScopedTimer::ScopedTimer(CompilerTimings& _timings, std::string _phase, std::string _contract):
+	m_timings(_timings)
+{
+	if (!m_timings.enabled())
+		return;
+
+	m_active = true;
+	m_phase = std::move(_phase);
+	m_contract = std::move(_contract);
+	m_start = std::chrono::steady_clock::now();
+}
+
+CompilerTimings::ScopedTimer::~ScopedTimer()
+{
+	if (!m_active)
+		return;
+
+	auto duration = std::chrono::steady_clock::now() - m_start;
+	m_timings.m_entries.push_back({
+		std::move(m_phase),
+		std::move(m_contract),
+		std::chrono::duration_cast<std::chrono::microseconds>(duration).count(),
+		peakRSSKilobytes()
+	});
+}
+
+Json CompilerTimings::toJson() const
+{
+	Json result = Json::array();
+	for (Entry const& entry: m_entries)
+	{
+		Json entryJson;
+		entryJson["phase"] = entry.phase;
+		if (!entry.contract.empty())
+			entryJson["contract"] = entry.contract;
+		entryJson["wallTimeMicroseconds"] = entry.wallTimeMicroseconds;
+		entryJson["peakRSSKilobytes"] = entry.peakRSSKilobytes;
+		result.emplace_back(std::move(entryJson));
+	}
+	return result;
+}
+
+void CompilerTimings::print(std::ostream& _out) const
+{
+	size_t phaseWidth = std::string("Phase").size();
+	for (Entry const& entry: m_entries)
+		phaseWidth = std::max(phaseWidth, entry.phase.size());
+
+	_out << fmt::format("{:<{}}  {:>12}  {:>14}  {}", "Phase", phaseWidth, "Time (ms)", "Peak RSS (KiB)", "Contract") << std::endl;
+	for (Entry const& entry: m_entries)
+		_out << fmt::format(
+			"{:<{}}  {:>12.3f}  {:>14}  {}",
+			entry.phase,
+			phaseWidth,
+			static_cast<double>(entry.wallTimeMicroseconds) / 1000.0,
+			entry.peakRSSKilobytes,
+			entry.contract
+		) << std::endl;
+}
+
+int64_t CompilerTimings::peakRSSKilobytes()
+{
+#if defined(__linux) || defined(__APPLE__)
+	rusage usage{};
+	if (getrusage(RUSAGE_SELF, &usage) != 0)
+		return 0;
+#if defined(__APPLE__)
+	// On macOS ru_maxrss is reported in bytes rather than kilobytes.
+	return static_cast<int64_t>(usage.ru_maxrss) / 1024;
+#else
+	return static_cast<int64_t>(usage.ru_maxrss);
+#endif
+#else
+	return 0;
+#endif
+}
@@ -0,0 +1,96 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Wall time and memory usage of the individual phases of a compilation.
+ */
+
+#pragma once
+
+#include <libsolutil/JSON.h>
+
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace solidity::frontend
+{
+
+/**
+ * Collects the wall time and the peak resident set size of the compiler phases
+ * (parsing, the individual analysis passes, code generation, optimisation, assembly, metadata)
+ * in the order in which they finish.
+ *
+ * Phases may nest (e.g. the metadata is created during code generation). Reported times are inclusive.
+ * Recording is disabled by default and measuring a phase is a no-op in that case.
+ */
+class CompilerTimings
+{
+public:
+	struct Entry
+	{
+		/// Name of the phase, e.g. "parsing" or "analysis.typeChecker".
+		std::string phase;
+		/// Fully qualified name of the contract or empty if the phase is not contract-specific.
+		std::string contract;
+		int64_t wallTimeMicroseconds = 0;
+		/// Peak resident set size of the process at the end of the phase or zero if not available on the platform.
+		int64_t peakRSSKilobytes = 0;
+	};
+
+	/// Measures the phase it is in scope for and records it in the given timings on destruction.
+	class ScopedTimer
+	{
+	public:
+		ScopedTimer(CompilerTimings& _timings, std::string _phase, std::string _contract = {});
+		~ScopedTimer();
+
+		ScopedTimer(ScopedTimer const&) = delete;
+		ScopedTimer& operator=(ScopedTimer const&) = delete;
+
+	private:
+		CompilerTimings& m_timings;
+		bool m_active = false;
+		std::string m_phase;
+		std::string m_contract;
+		std::chrono::steady_clock::time_point m_start;
+	};
+
+	void enable(bool _enable = true) { m_enabled = _enable; }
+	bool enabled() const { return m_enabled; }
+
+	void clear() { m_entries.clear(); }
+
+	std::vector<Entry> const& entries() const { return m_entries; }
+
+	/// @returns the recorded entries as a JSON array in the order in which the phases finished.
+	Json toJson() const;
+
+	/// Prints the recorded entries as a human-readable table.
+	void print(std::ostream& _out) const;
+
+	/// @returns the peak resident set size of the current process in kilobytes or zero if not available.
+	static int64_t peakRSSKilobytes();
+
+private:
+	bool m_enabled = false;
+	std::vector<Entry> m_entries;
+};
+
+}
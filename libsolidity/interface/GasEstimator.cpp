@@ -42,10 +42,24 @@ using namespace solidity::evmasm;
 using namespace solidity::frontend;
 using namespace solidity::langutil;
 
+PathGasMeter GasEstimator::pathGasMeter(AssemblyItems const& _items) const
+{
+	return PathGasMeter(_items, m_evmVersion, m_maxPaths);
+}
+
 GasEstimator::GasConsumption GasEstimator::functionalEstimation(
 	AssemblyItems const& _items,
 	std::string const& _signature
 ) const
+{
+	PathGasMeter meter = pathGasMeter(_items);
+	return functionalEstimation(meter, _signature);
+}
+
+GasEstimator::GasConsumption GasEstimator::functionalEstimation(
+	PathGasMeter& _meter,
+	std::string const& _signature
+) const
 {
 	auto state = std::make_shared<KnownState>();
 
@@ -78,7 +92,7 @@ GasEstimator::GasConsumption GasEstimator::functionalEstimation(
 		);
 	}
 
-	return PathGasMeter::estimateMax(_items, m_evmVersion, 0, state);
+	return _meter.estimateMax(0, state);
 }
 
 GasEstimator::GasConsumption GasEstimator::functionalEstimation(
@@ -86,6 +100,16 @@ GasEstimator::GasConsumption GasEstimator::functionalEstimation(
 	size_t const& _offset,
 	FunctionDefinition const& _function
 ) const
+{
+	PathGasMeter meter = pathGasMeter(_items);
+	return functionalEstimation(meter, _offset, _function);
+}
+
+GasEstimator::GasConsumption GasEstimator::functionalEstimation(
+	PathGasMeter& _meter,
+	size_t const& _offset,
+	FunctionDefinition const& _function
+) const
 {
 	auto state = std::make_shared<KnownState>();
 
@@ -100,7 +124,7 @@ GasEstimator::GasConsumption GasEstimator::functionalEstimation(
 	if (parametersSize > 0)
 		state->feedItem(swapInstruction(parametersSize));
 
-	return PathGasMeter::estimateMax(_items, m_evmVersion, _offset, state);
+	return _meter.estimateMax(_offset, state);
 }
 
 std::set<ASTNode const*> GasEstimator::finestNodesAtLocation(
@@ -27,8 +27,10 @@
 
 #include <libevmasm/Assembly.h>
 #include <libevmasm/GasMeter.h>
+#include <libevmasm/PathGasMeter.h>
 
 #include <array>
+#include <limits>
 #include <map>
 #include <vector>
 
@@ -46,7 +48,18 @@ public:
 	using ASTGasConsumptionSelfAccumulated =
 		std::map<ASTNode const*, std::array<GasConsumption, 2>>;
 
-	explicit GasEstimator(langutil::EVMVersion _evmVersion): m_evmVersion(_evmVersion) {}
+	/// @param _maxPaths maximum number of paths explored per estimate, see evmasm::PathGasMeter.
+	explicit GasEstimator(
+		langutil::EVMVersion _evmVersion,
+		size_t _maxPaths = std::numeric_limits<size_t>::max()
+	):
+		m_evmVersion(_evmVersion),
+		m_maxPaths(_maxPaths)
+	{}
+
+	/// @returns a path gas meter for @a _items, which should be used for all estimates on
+	/// the same items, so that the positions of their tags are only computed once.
+	evmasm::PathGasMeter pathGasMeter(evmasm::AssemblyItems const& _items) const;
 
 	/// @returns the estimated gas consumption by the (public or external) function with the
 	/// given signature. If no signature is given, estimates the maximum gas usage.
@@ -54,6 +67,10 @@ public:
 		evmasm::AssemblyItems const& _items,
 		std::string const& _signature = ""
 	) const;
+	GasConsumption functionalEstimation(
+		evmasm::PathGasMeter& _meter,
+		std::string const& _signature = ""
+	) const;
 
 	/// @returns the estimated gas consumption by the given function which starts at the given
 	/// offset into the list of assembly items.
@@ -63,11 +80,17 @@ public:
 		size_t const& _offset,
 		FunctionDefinition const& _function
 	) const;
+	GasConsumption functionalEstimation(
+		evmasm::PathGasMeter& _meter,
+		size_t const& _offset,
+		FunctionDefinition const& _function
+	) const;
 
 private:
 	/// @returns the set of AST nodes which are the finest nodes at their location.
 	static std::set<ASTNode const*> finestNodesAtLocation(std::vector<ASTNode const*> const& _roots);
 	langutil::EVMVersion m_evmVersion;
+	size_t m_maxPaths;
 };
 
 }
@@ -21,22 +21,63 @@
 
 #include <libsolutil/CommonIO.h>
 #include <libsolutil/Exceptions.h>
-#include <libsolutil/Keccak256.h>
-#include <libsolutil/TemporaryDirectory.h>
 
 #include <boost/algorithm/string/join.hpp>
 #include <boost/algorithm/string/predicate.hpp>
-#include <boost/filesystem.hpp>
-#include <boost/filesystem/fstream.hpp>
 #include <boost/process.hpp>
 
+#if !defined(_WIN32)
+#include <csignal>
+#include <pthread.h>
+#endif
+
 namespace solidity::frontend
 {
 
+namespace
+{
+
+/// Writes the query to the input of the solver and closes it.
+/// If the solver exits before reading all of it, the write fails instead of
+/// raising SIGPIPE, which would terminate the compiler.
+void writeQuery(boost::process::opstream& _input, std::string const& _query)
+{
+#if !defined(_WIN32)
+	sigset_t sigpipe;
+	sigemptyset(&sigpipe);
+	sigaddset(&sigpipe, SIGPIPE);
+	sigset_t pending;
+	sigpending(&pending);
+	bool const sigpipePending = sigismember(&pending, SIGPIPE);
+	sigset_t previousMask;
+	pthread_sigmask(SIG_BLOCK, &sigpipe, &previousMask);
+#endif
+
+	_input << _query;
+	_input.flush();
+	_input.pipe().close();
+
+#if !defined(_WIN32)
+	// Discard a SIGPIPE raised by the write, so that it is not delivered once unblocked.
+	sigpending(&pending);
+	if (!sigpipePending && sigismember(&pending, SIGPIPE))
+	{
+		int signal;
+		sigwait(&sigpipe, &signal);
+	}
+	pthread_sigmask(SIG_SETMASK, &previousMask, nullptr);
+#endif
+}
+
+}
+
 void SMTSolverCommand::setEldarica(std::optional<unsigned int> timeoutInMilliseconds, bool computeInvariants)
 {
+	std::lock_guard<std::mutex> lock(m_mutex);
 	m_arguments.clear();
 	m_solverCmd = "eld";
+	// Read the query from stdin.
+	m_arguments.emplace_back("-in");
 	if (timeoutInMilliseconds)
 	{
 		unsigned int timeoutInSeconds = timeoutInMilliseconds.value() / 1000u;
@@ -49,8 +90,10 @@ void SMTSolverCommand::setEldarica(std::optional<unsigned int> timeoutInMillisec
 
 void SMTSolverCommand::setCvc5(std::optional<unsigned int> timeoutInMilliseconds)
 {
+	std::lock_guard<std::mutex> lock(m_mutex);
 	m_arguments.clear();
 	m_solverCmd = "cvc5";
+	m_arguments.emplace_back("--lang=smt2");
 	if (timeoutInMilliseconds)
 	{
 		m_arguments.push_back("--tlimit-per");
@@ -70,32 +113,34 @@ ReadCallback::Result SMTSolverCommand::solve(std::string const& _kind, std::stri
 		if (_kind != ReadCallback::kindString(ReadCallback::Kind::SMTQuery))
 			solAssert(false, "SMTQuery callback used as callback kind " + _kind);
 
-		if (m_solverCmd.empty())
+		std::string solverCmd;
+		std::vector<std::string> args;
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			solverCmd = m_solverCmd;
+			args = m_arguments;
+		}
+		if (solverCmd.empty())
 			return ReadCallback::Result{false, "No solver set."};
 
-		auto tempDir = solidity::util::TemporaryDirectory("smt");
-		util::h256 queryHash = util::keccak256(_query);
-		auto queryFileName = tempDir.path() / ("query_" + queryHash.hex() + ".smt2");
-
-		auto queryFile = boost::filesystem::ofstream(queryFileName);
-		queryFile << _query << std::flush;
-
-		auto solverBin = boost::process::search_path(m_solverCmd);
+		auto solverBin = boost::process::search_path(solverCmd);
 
 		if (solverBin.empty())
-			return ReadCallback::Result{false, m_solverCmd + " binary not found."};
-
-		auto args = m_arguments;
-		args.push_back(queryFileName.string());
+			return ReadCallback::Result{false, solverCmd + " binary not found."};
 
+		// The query is piped into the solver instead of being written to a temporary file first.
+		boost::process::opstream input;
 		boost::process::ipstream pipe;
 		boost::process::child solverProcess(
 			solverBin,
 			args,
+			boost::process::std_in < input,
 			boost::process::std_out > pipe,
 			boost::process::std_err > boost::process::null
 		);
 
+		writeQuery(input, _query);
+
 		std::vector<std::string> data;
 		std::string line;
 		while (solverProcess.running() && std::getline(pipe, line))
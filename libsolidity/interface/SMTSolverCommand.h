@@ -21,10 +21,13 @@
 
 #include <boost/filesystem.hpp>
 
+#include <mutex>
+
 namespace solidity::frontend
 {
 
 /// SMTSolverCommand wraps an SMT solver called via its binary in the OS.
+/// Queries may be solved concurrently, e.g. by CHC solving several verification targets at once.
 class SMTSolverCommand
 {
 public:
@@ -43,6 +46,8 @@ private:
 	/// The name of the solver's binary.
 	std::string m_solverCmd;
 	std::vector<std::string> m_arguments;
+	/// Guards the solver command and its arguments against concurrent reconfiguration.
+	std::mutex m_mutex;
 };
 
 }
@@ -316,6 +316,22 @@ bool isIRRequested(Json const& _outputSelection)
 	return false;
 }
 
+/// @returns true if the compiler timings were requested. They are not matched by '*'
+/// because they differ between runs.
+bool isCompilerTimingsRequested(Json const& _outputSelection)
+{
+	if (!_outputSelection.is_object())
+		return false;
+
+	for (auto const& fileRequests: _outputSelection)
+		for (auto const& requests: fileRequests)
+			for (auto const& request: requests)
+				if (request == "compilerTimings")
+					return true;
+
+	return false;
+}
+
 Json formatLinkReferences(std::map<size_t, std::string> const& linkReferences)
 {
 	Json ret = Json::object();
@@ -425,13 +441,19 @@ std::optional<Json> checkAuxiliaryInputKeys(Json const& _input)
 
 std::optional<Json> checkSettingsKeys(Json const& _input)
 {
-	static std::set<std::string> keys{"debug", "evmVersion", "libraries", "metadata", "modelChecker", "optimizer", "outputSelection", "remappings", "stopAfter", "viaIR"};
+	static std::set<std::string> keys{"debug", "evmVersion", "gasEstimation", "jobs", "libraries", "metadata", "modelChecker", "optimizer", "outputSelection", "remappings", "stopAfter", "viaIR"};
 	return checkKeys(_input, keys, "settings");
 }
 
+std::optional<Json> checkGasEstimationKeys(Json const& _input)
+{
+	static std::set<std::string> keys{"maxPaths"};
+	return checkKeys(_input, keys, "settings.gasEstimation");
+}
+
 std::optional<Json> checkModelCheckerSettingsKeys(Json const& _input)
 {
-	static std::set<std::string> keys{"bmcLoopIterations", "contracts", "divModNoSlacks", "engine", "extCalls", "invariants", "printQuery", "showProvedSafe", "showUnproved", "showUnsupported", "solvers", "targets", "timeout"};
+	static std::set<std::string> keys{"bmcLoopIterations", "contracts", "divModNoSlacks", "engine", "extCalls", "invariants", "jobs", "printQuery", "printStats", "showProvedSafe", "showUnproved", "showUnsupported", "solvers", "targets", "timeout"};
 	return checkKeys(_input, keys, "modelChecker");
 }
 
@@ -816,6 +838,33 @@ std::variant<StandardCompiler::InputsAndSettings, Json> StandardCompiler::parseI
 		ret.viaIR = settings["viaIR"].get<bool>();
 	}
 
+	if (settings.contains("jobs"))
+	{
+		auto const& jobs = settings["jobs"];
+		if (!jobs.is_number_unsigned() || jobs.get<Json::number_unsigned_t>() == 0)
+			return formatFatalError(Error::Type::JSONError, "settings.jobs must be a positive integer.");
+		if (jobs.get<Json::number_unsigned_t>() > CompilerStack::c_maxJobs)
+			return formatFatalError(
+				Error::Type::JSONError,
+				"settings.jobs must not be greater than " + std::to_string(CompilerStack::c_maxJobs) + "."
+			);
+		ret.jobs = static_cast<size_t>(jobs.get<Json::number_unsigned_t>());
+	}
+
+	if (settings.contains("gasEstimation"))
+	{
+		auto const& gasEstimation = settings["gasEstimation"];
+		if (auto result = checkGasEstimationKeys(gasEstimation))
+			return *result;
+		if (gasEstimation.contains("maxPaths"))
+		{
+			auto const& maxPaths = gasEstimation["maxPaths"];
+			if (!maxPaths.is_number_unsigned() || maxPaths.get<Json::number_unsigned_t>() == 0)
+				return formatFatalError(Error::Type::JSONError, "settings.gasEstimation.maxPaths must be a positive integer.");
+			ret.gasEstimationMaxPaths = maxPaths.get<size_t>();
+		}
+	}
+
 	if (settings.contains("evmVersion"))
 	{
 		if (!settings["evmVersion"].is_string())
@@ -1089,6 +1138,19 @@ std::variant<StandardCompiler::InputsAndSettings, Json> StandardCompiler::parseI
 		ret.modelCheckerSettings.invariants = invariants;
 	}
 
+	if (modelCheckerSettings.contains("jobs"))
+	{
+		auto const& jobs = modelCheckerSettings["jobs"];
+		if (!jobs.is_number_unsigned() || jobs.get<Json::number_unsigned_t>() == 0)
+			return formatFatalError(Error::Type::JSONError, "settings.modelChecker.jobs must be a positive integer.");
+		if (jobs.get<Json::number_unsigned_t>() > CompilerStack::c_maxJobs)
+			return formatFatalError(
+				Error::Type::JSONError,
+				"settings.modelChecker.jobs must not be greater than " + std::to_string(CompilerStack::c_maxJobs) + "."
+			);
+		ret.modelCheckerSettings.jobs = static_cast<unsigned>(jobs.get<Json::number_unsigned_t>());
+	}
+
 	if (modelCheckerSettings.contains("showProvedSafe"))
 	{
 		auto const& showProvedSafe = modelCheckerSettings["showProvedSafe"];
@@ -1143,6 +1205,14 @@ std::variant<StandardCompiler::InputsAndSettings, Json> StandardCompiler::parseI
 		ret.modelCheckerSettings.printQuery = printQuery.get<bool>();
 	}
 
+	if (modelCheckerSettings.contains("printStats"))
+	{
+		auto const& printStats = modelCheckerSettings["printStats"];
+		if (!printStats.is_boolean())
+			return formatFatalError(Error::Type::JSONError, "settings.modelChecker.printStats must be a Boolean value.");
+		ret.modelCheckerSettings.printStats = printStats.get<bool>();
+	}
+
 	if (modelCheckerSettings.contains("targets"))
 	{
 		auto const& targetsArray = modelCheckerSettings["targets"];
@@ -1306,6 +1376,9 @@ Json StandardCompiler::compileSolidity(StandardCompiler::InputsAndSettings _inpu
 	for (auto const& smtLib2Response: _inputsAndSettings.smtLib2Responses)
 		compilerStack.addSMTLib2Response(smtLib2Response.first, smtLib2Response.second);
 	compilerStack.setViaIR(_inputsAndSettings.viaIR);
+	compilerStack.setJobs(_inputsAndSettings.jobs);
+	if (_inputsAndSettings.gasEstimationMaxPaths)
+		compilerStack.setGasEstimationMaxPaths(*_inputsAndSettings.gasEstimationMaxPaths);
 	compilerStack.setEVMVersion(_inputsAndSettings.evmVersion);
 	compilerStack.setRemappings(std::move(_inputsAndSettings.remappings));
 	compilerStack.setOptimiserSettings(std::move(_inputsAndSettings.optimiserSettings));
@@ -1321,6 +1394,7 @@ Json StandardCompiler::compileSolidity(StandardCompiler::InputsAndSettings _inpu
 
 	compilerStack.enableEvmBytecodeGeneration(isEvmBytecodeRequested(_inputsAndSettings.outputSelection));
 	compilerStack.enableIRGeneration(isIRRequested(_inputsAndSettings.outputSelection));
+	compilerStack.enableTimings(isCompilerTimingsRequested(_inputsAndSettings.outputSelection));
 
 	Json errors = std::move(_inputsAndSettings.errors);
 
@@ -1586,6 +1660,10 @@ Json StandardCompiler::compileSolidity(StandardCompiler::InputsAndSettings _inpu
 	if (!contractsOutput.empty())
 		output["contracts"] = contractsOutput;
 
+	// Filled last so that lazily generated artifacts like the metadata are included.
+	if (compilerStack.timings().enabled())
+		output["compilerTimings"] = compilerStack.timings().toJson();
+
 	return output;
 }
 
@@ -1641,7 +1719,8 @@ Json StandardCompiler::compileYul(InputsAndSettings _inputsAndSettings)
 		_inputsAndSettings.optimiserSettings,
 		_inputsAndSettings.debugInfoSelection.has_value() ?
 			_inputsAndSettings.debugInfoSelection.value() :
-			DebugInfoSelection::Default()
+			DebugInfoSelection::Default(),
+		_inputsAndSettings.jobs
 	);
 	std::string const& sourceName = _inputsAndSettings.sources.begin()->first;
 	std::string const& sourceContents = _inputsAndSettings.sources.begin()->second;
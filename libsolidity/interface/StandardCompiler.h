@@ -89,6 +89,8 @@ private:
 		Json outputSelection;
 		ModelCheckerSettings modelCheckerSettings = ModelCheckerSettings{};
 		bool viaIR = false;
+		size_t jobs = 1;
+		std::optional<size_t> gasEstimationMaxPaths;
 	};
 
 	/// Parses the input json (and potentially invokes the read callback) and either returns
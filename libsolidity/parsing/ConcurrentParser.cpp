@@ -0,0 +1,129 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+#include <libsolidity/parsing/ConcurrentParser.h>
+
+#include <libsolidity/parsing/Parser.h>
+
+#include <liblangutil/CharStream.h>
+#include <liblangutil/ErrorReporter.h>
+
+#include <algorithm>
+
+using namespace solidity;
+using namespace solidity::langutil;
+using namespace solidity::frontend;
+
+ConcurrentParser::ConcurrentParser(EVMVersion _evmVersion, size_t _jobs):
+	m_evmVersion(_evmVersion),
+	m_jobs(_jobs)
+{
+	solAssert(m_jobs > 0);
+}
+
+ConcurrentParser::~ConcurrentParser()
+{
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_stopped = true;
+	}
+	m_added.notify_all();
+	for (std::thread& worker: m_workers)
+		worker.join();
+}
+
+void ConcurrentParser::add(std::shared_ptr<CharStream> _charStream)
+{
+	solAssert(_charStream);
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_charStreams.emplace_back(std::move(_charStream));
+		m_results.emplace_back();
+	}
+	// Workers are only started as needed, so that there are never more workers than source units.
+	// m_workers is only accessed from the thread that owns the parser.
+	if (m_workers.size() < std::min(m_jobs, m_results.size()))
+		m_workers.emplace_back([this]() { work(); });
+	m_added.notify_one();
+}
+
+ASTPointer<SourceUnit> ConcurrentParser::takeNext(ErrorReporter& _errorReporter)
+{
+	Result result;
+	{
+		std::unique_lock<std::mutex> lock(m_mutex);
+		size_t index = m_nextToTake++;
+		solAssert(index < m_results.size());
+		m_parsed.wait(lock, [&]() { return m_results[index].has_value(); });
+		result = std::move(*m_results[index]);
+		m_results[index].reset();
+		m_charStreams[index].reset();
+	}
+
+	if (result.exception)
+		std::rethrow_exception(result.exception);
+
+	_errorReporter.append(result.errors);
+	Parser::shiftNodeIDs(result.nodes, m_maxID);
+	m_maxID += result.maxID;
+	return result.ast;
+}
+
+void ConcurrentParser::work()
+{
+	while (true)
+	{
+		std::shared_ptr<CharStream> charStream;
+		size_t index = 0;
+		{
+			std::unique_lock<std::mutex> lock(m_mutex);
+			m_added.wait(lock, [&]() { return m_stopped || m_nextToParse < m_charStreams.size(); });
+			if (m_stopped)
+				return;
+			index = m_nextToParse++;
+			charStream = m_charStreams[index];
+		}
+
+		Result result = parse(*charStream);
+
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_results[index] = std::move(result);
+		}
+		m_parsed.notify_all();
+	}
+}
+
+ConcurrentParser::Result ConcurrentParser::parse(CharStream& _charStream) const
+{
+	Result result;
+	try
+	{
+		ErrorReporter errorReporter(result.errors);
+		Parser parser{errorReporter, m_evmVersion};
+		parser.trackCreatedNodes();
+		result.ast = parser.parse(_charStream);
+		result.maxID = parser.maxID();
+		result.nodes = parser.takeCreatedNodes();
+	}
+	catch (...)
+	{
+		result.exception = std::current_exception();
+	}
+	return result;
+}
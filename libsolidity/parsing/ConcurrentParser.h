@@ -0,0 +1,106 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Parses source units on several threads while assigning the same AST IDs as a single parser.
+ */
+
+#pragma once
+
+#include <libsolidity/ast/AST.h>
+
+#include <liblangutil/EVMVersion.h>
+#include <liblangutil/Exceptions.h>
+
+#include <condition_variable>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+namespace solidity::langutil
+{
+class CharStream;
+class ErrorReporter;
+}
+
+namespace solidity::frontend
+{
+
+/**
+ * Parses the added source units on up to a fixed number of worker threads.
+ * A worker is started for each added source unit until that number is reached.
+ *
+ * Every source unit is parsed by its own parser into its own error list, so its node IDs start at 1.
+ * The results have to be taken in the order in which the source units were added, which is the
+ * order in which a single parser would have parsed them. Taking a result moves its node IDs behind
+ * the IDs of the source units taken before and appends its errors, so that the AST and the
+ * reported errors are the same as with a single parser.
+ */
+class ConcurrentParser
+{
+public:
+	ConcurrentParser(langutil::EVMVersion _evmVersion, size_t _jobs);
+	/// Waits for the source unit that is currently parsed by each worker and discards the rest.
+	~ConcurrentParser();
+
+	/// Schedules @a _charStream to be parsed after all source units added before.
+	void add(std::shared_ptr<langutil::CharStream> _charStream);
+
+	/// Waits until the next source unit in the order of add() is parsed, appends the reported errors
+	/// to @a _errorReporter and moves its node IDs behind the ones returned so far.
+	/// Rethrows exceptions that escaped the parser.
+	/// @returns the AST or nullptr if parsing failed.
+	ASTPointer<SourceUnit> takeNext(langutil::ErrorReporter& _errorReporter);
+
+	/// @returns the maximal AST node ID of all source units taken so far.
+	int64_t maxID() const { return m_maxID; }
+
+private:
+	struct Result
+	{
+		ASTPointer<SourceUnit> ast;
+		langutil::ErrorList errors;
+		int64_t maxID = 0;
+		std::vector<std::weak_ptr<ASTNode>> nodes;
+		std::exception_ptr exception;
+	};
+
+	void work();
+	Result parse(langutil::CharStream& _charStream) const;
+
+	langutil::EVMVersion const m_evmVersion;
+	size_t const m_jobs;
+	std::mutex m_mutex;
+	/// Notified when a source unit is added or the parser is destroyed.
+	std::condition_variable m_added;
+	/// Notified when a source unit is parsed.
+	std::condition_variable m_parsed;
+	std::vector<std::shared_ptr<langutil::CharStream>> m_charStreams;
+	std::vector<std::optional<Result>> m_results;
+	/// Index of the next source unit a worker starts to parse.
+	size_t m_nextToParse = 0;
+	/// Index of the next source unit returned by takeNext().
+	size_t m_nextToTake = 0;
+	bool m_stopped = false;
+	int64_t m_maxID = 0;
+	std::vector<std::thread> m_workers;
+};
+
+}
@@ -39,6 +39,7 @@
 
 #include <cctype>
 #include <memory>
+#include <mutex>
 #include <regex>
 #include <tuple>
 #include <vector>
@@ -49,6 +50,13 @@ using namespace std::string_literals;
 namespace solidity::frontend
 {
 
+namespace
+{
+/// Guards the dialects and the YulString repository used by the Yul parser,
+/// since source units can be parsed concurrently.
+std::mutex inlineAssemblyMutex;
+}
+
 /// AST node factory that also tracks the begin and end position of an AST node
 /// while it is being parsed
 class Parser::ASTNodeFactory
@@ -76,7 +84,9 @@ public:
 		solAssert(m_location.sourceName, "");
 		if (m_location.end < 0)
 			markEndPosition();
-		return std::make_shared<NodeType>(m_parser.nextID(), m_location, std::forward<Args>(_args)...);
+		auto node = std::make_shared<NodeType>(m_parser.nextID(), m_location, std::forward<Args>(_args)...);
+		m_parser.nodeCreated(node);
+		return node;
 	}
 
 	SourceLocation const& location() const noexcept { return m_location; }
@@ -183,6 +193,13 @@ ASTPointer<SourceUnit> Parser::parse(CharStream& _charStream)
 	}
 }
 
+void Parser::shiftNodeIDs(std::vector<std::weak_ptr<ASTNode>> const& _nodes, int64_t _offset)
+{
+	for (std::weak_ptr<ASTNode> const& node: _nodes)
+		if (ASTPointer<ASTNode> alive = node.lock())
+			alive->m_id = static_cast<size_t>(alive->id() + _offset);
+}
+
 void Parser::parsePragmaVersion(SourceLocation const& _location, std::vector<Token> const& _tokens, std::vector<std::string> const& _literals)
 {
 	SemVerMatchExpressionParser parser(_tokens, _literals);
@@ -1432,6 +1449,7 @@ ASTPointer<Statement> Parser::parseStatement(bool _allowUnchecked)
 ASTPointer<InlineAssembly> Parser::parseInlineAssembly(ASTPointer<ASTString> const& _docString)
 {
 	RecursionGuard recursionGuard(*this);
+	std::lock_guard<std::mutex> lock(inlineAssemblyMutex);
 	SourceLocation location = currentLocation();
 
 	expectToken(Token::Assembly);
@@ -1465,7 +1483,9 @@ ASTPointer<InlineAssembly> Parser::parseInlineAssembly(ASTPointer<ASTString> con
 		BOOST_THROW_EXCEPTION(FatalError());
 
 	location.end = nativeLocationOf(*block).end;
-	return std::make_shared<InlineAssembly>(nextID(), location, _docString, dialect, std::move(flags), block);
+	auto inlineAssembly = std::make_shared<InlineAssembly>(nextID(), location, _docString, dialect, std::move(flags), block);
+	nodeCreated(inlineAssembly);
+	return inlineAssembly;
 }
 
 ASTPointer<IfStatement> Parser::parseIfStatement(ASTPointer<ASTString> const& _docString)
@@ -50,6 +50,15 @@ public:
 
 	/// Returns the maximal AST node ID assigned so far
 	int64_t maxID() const { return m_currentNodeID; }
+
+	/// Makes the parser remember all nodes it creates from now on, so that their IDs can be
+	/// moved via shiftNodeIDs() once the number of IDs used by the preceding source units is known.
+	void trackCreatedNodes() { m_trackCreatedNodes = true; }
+	/// @returns the nodes created since trackCreatedNodes() and forgets them.
+	std::vector<std::weak_ptr<ASTNode>> takeCreatedNodes() { return std::move(m_createdNodes); }
+	/// Adds @a _offset to the IDs of all nodes in @a _nodes that are still alive.
+	/// Must only be called before the nodes are used by anything else.
+	static void shiftNodeIDs(std::vector<std::weak_ptr<ASTNode>> const& _nodes, int64_t _offset);
 private:
 	class ASTNodeFactory;
 
@@ -213,6 +222,12 @@ private:
 
 	/// Returns the next AST node ID
 	int64_t nextID() { return ++m_currentNodeID; }
+	/// Remembers @a _node for shiftNodeIDs() if requested via trackCreatedNodes().
+	void nodeCreated(ASTPointer<ASTNode> const& _node)
+	{
+		if (m_trackCreatedNodes)
+			m_createdNodes.emplace_back(_node);
+	}
 
 	std::pair<LookAheadInfo, IndexAccessedPath> tryParseIndexAccessedPath();
 	/// Performs limited look-ahead to distinguish between variable declaration and expression statement.
@@ -249,6 +264,9 @@ private:
 	langutil::EVMVersion m_evmVersion;
 	/// Counter for the next AST node ID
 	int64_t m_currentNodeID = 0;
+	bool m_trackCreatedNodes = false;
+	/// Nodes created since trackCreatedNodes(), including the ones that were discarded during parsing.
+	std::vector<std::weak_ptr<ASTNode>> m_createdNodes;
 	/// Flag that indicates whether experimental mode is enabled in the current source unit
 	bool m_experimentalSolidityEnabledInCurrentSourceUnit = false;
 };
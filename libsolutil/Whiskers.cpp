@@ -26,12 +26,330 @@
 
 #include <libsolutil/Assertions.h>
 
-#include <regex>
+#include <mutex>
+#include <optional>
+#include <string_view>
+#include <unordered_map>
 
 using namespace solidity::util;
 
+namespace
+{
+
+bool isParameterCharacter(char _c)
+{
+	return
+		('a' <= _c && _c <= 'z') ||
+		('A' <= _c && _c <= 'Z') ||
+		('0' <= _c && _c <= '9') ||
+		_c == '_' || _c == '$' || _c == '-';
+}
+
+/// @returns the position past the (possibly empty) run of parameter characters starting at @a _pos.
+size_t parameterEnd(std::string_view _text, size_t _pos)
+{
+	while (_pos < _text.size() && isParameterCharacter(_text[_pos]))
+		++_pos;
+	return _pos;
+}
+
+/// @returns the position of the ``>`` closing a tag whose name starts at @a _nameStart
+/// or std::nullopt if there is no valid name followed by ``>``.
+std::optional<size_t> tagNameEnd(std::string_view _text, size_t _nameStart)
+{
+	size_t end = parameterEnd(_text, _nameStart);
+	if (end == _nameStart || end >= _text.size() || _text[end] != '>')
+		return std::nullopt;
+	return end;
+}
+
+}
+
+struct Whiskers::Template
+{
+	struct Node
+	{
+		enum class Kind { Text, Parameter, List, Condition };
+		Kind kind = Kind::Text;
+		/// The text for text nodes, otherwise the name of the tag (including the leading ``+`` of
+		/// conditional value parameters).
+		std::string value;
+		/// The body of a list or the part of a condition that is rendered if the condition is true.
+		std::shared_ptr<Template const> body;
+		/// The part of a condition that is rendered if the condition is false.
+		std::shared_ptr<Template const> elseBody;
+	};
+
+	/// The text of the (sub-)template, used in error messages.
+	std::string source;
+	std::vector<Node> nodes;
+	/// The first invalid or unclosed tag in the template, if any.
+	std::optional<std::string> invalidTag;
+
+	/// @returns the parsed template for @a _source, parsing it only if it was not requested before.
+	static std::shared_ptr<Template const> get(std::string const& _source);
+
+	/// Parses @a _source. A tag is recognised at the leftmost position at which it is complete, and lists
+	/// and conditions extend to the first matching closing (or else) tag. Bodies are parsed independently.
+	static std::shared_ptr<Template> parse(std::string_view _source);
+
+	/// Appends the rendered template to @a _output. Parameters are looked up in @a _listElement first (if given)
+	/// and then in @a _parameters. List parameters are not available inside of lists.
+	void render(
+		std::string& _output,
+		StringMap const& _parameters,
+		StringMap const* _listElement,
+		std::map<std::string, bool> const& _conditions,
+		StringListMap const* _listParameters
+	) const;
+
+private:
+	/// Tries to match a tag starting with the ``<`` at @a _pos.
+	/// @returns the position past the tag and the tag node or std::nullopt if there is no tag at @a _pos.
+	static std::optional<std::pair<size_t, Node>> matchTag(std::string_view _source, size_t _pos);
+	/// @returns the first invalid or unclosed tag in @a _source, if any.
+	static std::optional<std::string> findInvalidTag(std::string_view _source);
+};
+
+std::shared_ptr<Whiskers::Template const> Whiskers::Template::get(std::string const& _source)
+{
+	// Templates are mostly string literals, so the number of distinct templates is small. The limit only guards
+	// against templates that are generated dynamically in long-running processes.
+	static size_t constexpr maxCacheSize = 4096;
+	static std::mutex mutex;
+	static std::unordered_map<std::string, std::shared_ptr<Template const>> cache;
+
+	std::lock_guard<std::mutex> lock(mutex);
+	if (auto it = cache.find(_source); it != cache.end())
+		return it->second;
+	if (cache.size() >= maxCacheSize)
+		cache.clear();
+	std::shared_ptr<Template> parsed = parse(_source);
+	parsed->invalidTag = findInvalidTag(_source);
+	cache.emplace(_source, parsed);
+	return parsed;
+}
+
+std::shared_ptr<Whiskers::Template> Whiskers::Template::parse(std::string_view _source)
+{
+	auto result = std::make_shared<Template>();
+	result->source = std::string(_source);
+
+	size_t textStart = 0;
+	auto flushText = [&](size_t _end) {
+		if (_end > textStart)
+			result->nodes.push_back(Node{Node::Kind::Text, std::string(_source.substr(textStart, _end - textStart)), {}, {}});
+	};
+	size_t pos = _source.find('<');
+	while (pos != std::string_view::npos)
+		if (auto match = matchTag(_source, pos))
+		{
+			flushText(pos);
+			result->nodes.emplace_back(std::move(match->second));
+			textStart = match->first;
+			pos = _source.find('<', textStart);
+		}
+		else
+			pos = _source.find('<', pos + 1);
+	flushText(_source.size());
+	return result;
+}
+
+std::optional<std::pair<size_t, Whiskers::Template::Node>> Whiskers::Template::matchTag(std::string_view _source, size_t _pos)
+{
+	if (_pos + 1 >= _source.size())
+		return std::nullopt;
+
+	if (_source[_pos + 1] == '#')
+	{
+		// <#name>...</name>
+		size_t nameStart = _pos + 2;
+		std::optional<size_t> nameEnd = tagNameEnd(_source, nameStart);
+		if (!nameEnd)
+			return std::nullopt;
+		std::string name(_source.substr(nameStart, *nameEnd - nameStart));
+		std::string closingTag = "</" + name + ">";
+		size_t bodyStart = *nameEnd + 1;
+		size_t closingPos = _source.find(closingTag, bodyStart);
+		if (closingPos == std::string_view::npos)
+			return std::nullopt;
+		return std::make_pair(
+			closingPos + closingTag.size(),
+			Node{Node::Kind::List, std::move(name), parse(_source.substr(bodyStart, closingPos - bodyStart)), {}}
+		);
+	}
+	else if (_source[_pos + 1] == '?')
+	{
+		// <?name>...<!name>...</name> or <?+name>...<!+name>...</+name>, where the else part is optional.
+		size_t nameStart = _pos + 2;
+		size_t plusEnd = nameStart < _source.size() && _source[nameStart] == '+' ? nameStart + 1 : nameStart;
+		std::optional<size_t> nameEnd = tagNameEnd(_source, plusEnd);
+		if (!nameEnd)
+			return std::nullopt;
+		std::string name(_source.substr(nameStart, *nameEnd - nameStart));
+		std::string elseTag = "<!" + name + ">";
+		std::string closingTag = "</" + name + ">";
+		size_t bodyStart = *nameEnd + 1;
+		size_t elsePos = _source.find(elseTag, bodyStart);
+		size_t closingPos = _source.find(closingTag, bodyStart);
+		if (elsePos != std::string_view::npos && elsePos < closingPos)
+		{
+			size_t elseStart = elsePos + elseTag.size();
+			closingPos = _source.find(closingTag, elseStart);
+			if (closingPos == std::string_view::npos)
+				return std::nullopt;
+			return std::make_pair(
+				closingPos + closingTag.size(),
+				Node{
+					Node::Kind::Condition,
+					std::move(name),
+					parse(_source.substr(bodyStart, elsePos - bodyStart)),
+					parse(_source.substr(elseStart, closingPos - elseStart))
+				}
+			);
+		}
+		if (closingPos == std::string_view::npos)
+			return std::nullopt;
+		return std::make_pair(
+			closingPos + closingTag.size(),
+			Node{Node::Kind::Condition, std::move(name), parse(_source.substr(bodyStart, closingPos - bodyStart)), parse({})}
+		);
+	}
+	else
+	{
+		// <name>
+		size_t nameStart = _pos + 1;
+		std::optional<size_t> nameEnd = tagNameEnd(_source, nameStart);
+		if (!nameEnd)
+			return std::nullopt;
+		return std::make_pair(
+			*nameEnd + 1,
+			Node{Node::Kind::Parameter, std::string(_source.substr(nameStart, *nameEnd - nameStart)), {}, {}}
+		);
+	}
+}
+
+std::optional<std::string> Whiskers::Template::findInvalidTag(std::string_view _source)
+{
+	// Finds tags of the form <#name, <?name, <!name or </name (optionally with a + in front of the name)
+	// that are followed by the end of the template or by a character other than >.
+	for (size_t pos = _source.find('<'); pos != std::string_view::npos; pos = _source.find('<', pos + 1))
+	{
+		if (pos + 1 >= _source.size())
+			break;
+		char kind = _source[pos + 1];
+		if (kind != '#' && kind != '?' && kind != '!' && kind != '/')
+			continue;
+		size_t nameStart = pos + 2;
+		if (nameStart < _source.size() && _source[nameStart] == '+')
+			++nameStart;
+		size_t nameEnd = parameterEnd(_source, nameStart);
+		if (nameEnd == nameStart)
+			continue;
+		if (nameEnd == _source.size())
+			return std::string(_source.substr(pos));
+		if (_source[nameEnd] != '>')
+			return std::string(_source.substr(pos, nameEnd + 1 - pos));
+	}
+	return std::nullopt;
+}
+
+void Whiskers::Template::render(
+	std::string& _output,
+	StringMap const& _parameters,
+	StringMap const* _listElement,
+	std::map<std::string, bool> const& _conditions,
+	StringListMap const* _listParameters
+) const
+{
+	auto findParameter = [&](std::string const& _name) -> std::string const* {
+		if (_listElement)
+			if (auto it = _listElement->find(_name); it != _listElement->end())
+				return &it->second;
+		if (auto it = _parameters.find(_name); it != _parameters.end())
+			return &it->second;
+		return nullptr;
+	};
+	auto findList = [&](std::string const& _name) -> std::vector<StringMap> const* {
+		if (_listParameters)
+			if (auto it = _listParameters->find(_name); it != _listParameters->end())
+				return &it->second;
+		return nullptr;
+	};
+
+	for (Node const& node: nodes)
+		switch (node.kind)
+		{
+		case Node::Kind::Text:
+			_output += node.value;
+			break;
+		case Node::Kind::Parameter:
+		{
+			std::string const* value = findParameter(node.value);
+			assertThrow(
+				value,
+				WhiskersError,
+				"Value for tag " + node.value + " not provided.\n" +
+				"Template:\n" +
+				source
+			);
+			_output += *value;
+			break;
+		}
+		case Node::Kind::List:
+		{
+			std::vector<StringMap> const* list = findList(node.value);
+			assertThrow(list, WhiskersError, "List parameter " + node.value + " not set.");
+			for (StringMap const& element: *list)
+			{
+				for (auto const& entry: element)
+					assertThrow(
+						!_parameters.count(entry.first) && !(_listElement && _listElement->count(entry.first)),
+						WhiskersError,
+						"Parameter collision"
+					);
+				node.body->render(_output, _parameters, &element, _conditions, nullptr);
+			}
+			break;
+		}
+		case Node::Kind::Condition:
+		{
+			bool conditionValue = false;
+			if (node.value[0] == '+')
+			{
+				std::string tag = node.value.substr(1);
+
+				if (std::string const* value = findParameter(tag))
+					conditionValue = !value->empty();
+				else if (std::vector<StringMap> const* list = findList(tag))
+					conditionValue = !list->empty();
+				else
+					assertThrow(false, WhiskersError, "Tag " + tag + " used as condition but was not set.");
+			}
+			else
+			{
+				auto it = _conditions.find(node.value);
+				assertThrow(
+					it != _conditions.end(),
+					WhiskersError, "Condition parameter " + node.value + " not set."
+				);
+				conditionValue = it->second;
+			}
+			(conditionValue ? node.body : node.elseBody)->render(
+				_output,
+				_parameters,
+				_listElement,
+				_conditions,
+				_listParameters
+			);
+			break;
+		}
+		}
+}
+
 Whiskers::Whiskers(std::string _template):
-	m_template(std::move(_template))
+	m_template(std::move(_template)),
+	m_compiledTemplate(Template::get(m_template))
 {
 	checkTemplateValid();
 }
@@ -71,25 +389,25 @@ Whiskers& Whiskers::operator()(
 
 std::string Whiskers::render() const
 {
-	return replace(m_template, m_parameters, m_conditions, m_listParameters);
+	std::string result;
+	result.reserve(m_template.size());
+	m_compiledTemplate->render(result, m_parameters, nullptr, m_conditions, &m_listParameters);
+	return result;
 }
 
 void Whiskers::checkTemplateValid() const
 {
-	std::regex validTemplate("<[#?!\\/]\\+{0,1}[a-zA-Z0-9_$-]+(?:[^a-zA-Z0-9_$>-]|$)");
-	std::smatch match;
 	assertThrow(
-		!regex_search(m_template, match, validTemplate),
+		!m_compiledTemplate->invalidTag,
 		WhiskersError,
-		"Template contains an invalid/unclosed tag " + match.str()
+		"Template contains an invalid/unclosed tag " + m_compiledTemplate->invalidTag.value_or("")
 	);
 }
 
 void Whiskers::checkParameterValid(std::string const& _parameter) const
 {
-	static std::regex validParam("^" + paramRegex() + "$");
 	assertThrow(
-		regex_match(_parameter, validParam),
+		!_parameter.empty() && parameterEnd(_parameter, 0) == _parameter.size(),
 		WhiskersError,
 		"Parameter" + _parameter + " contains invalid characters."
 	);
@@ -126,118 +444,3 @@ void Whiskers::checkTemplateContainsTags(std::string const& _parameter, std::vec
 		);
 	}
 }
-
-namespace
-{
-template<class ReplaceCallback>
-std::string regex_replace(
-	std::string const& _source,
-	std::regex const& _pattern,
-	ReplaceCallback _replace,
-	std::regex_constants::match_flag_type _flags = std::regex_constants::match_default
-)
-{
-	std::sregex_iterator curMatch(_source.begin(), _source.end(), _pattern, _flags);
-	std::sregex_iterator matchEnd;
-	std::string::const_iterator lastMatchedPos(_source.cbegin());
-	std::string result;
-	while (curMatch != matchEnd)
-	{
-		result.append(curMatch->prefix().first, curMatch->prefix().second);
-		result.append(_replace(*curMatch));
-		lastMatchedPos = (*curMatch)[0].second;
-		++curMatch;
-	}
-	result.append(lastMatchedPos, _source.cend());
-	return result;
-}
-}
-
-std::string Whiskers::replace(
-	std::string const& _template,
-	StringMap const& _parameters,
-	std::map<std::string, bool> const& _conditions,
-	std::map<std::string, std::vector<StringMap>> const& _listParameters
-)
-{
-	static std::regex listOrTag(
-		"<(" + paramRegex() + ")>|"
-		"<#(" + paramRegex() + ")>((?:.|\\r|\\n)*?)</\\2>|"
-		"<\\?(\\+?" + paramRegex() + ")>((?:.|\\r|\\n)*?)(<!\\4>((?:.|\\r|\\n)*?))?</\\4>"
-	);
-	return regex_replace(_template, listOrTag, [&](std::match_results<std::string::const_iterator> _match) -> std::string
-	{
-		std::string tagName(_match[1]);
-		std::string listName(_match[2]);
-		std::string conditionName(_match[4]);
-		if (!tagName.empty())
-		{
-			assertThrow(
-				_parameters.count(tagName),
-				WhiskersError,
-				"Value for tag " + tagName + " not provided.\n" +
-				"Template:\n" +
-				_template
-			);
-			return _parameters.at(tagName);
-		}
-		else if (!listName.empty())
-		{
-			std::string templ(_match[3]);
-			assertThrow(
-				_listParameters.count(listName),
-				WhiskersError, "List parameter " + listName + " not set."
-			);
-			std::string replacement;
-			for (auto const& parameters: _listParameters.at(listName))
-				replacement += replace(templ, joinMaps(_parameters, parameters), _conditions);
-			return replacement;
-		}
-		else
-		{
-			assertThrow(!conditionName.empty(), WhiskersError, "");
-			bool conditionValue = false;
-			if (conditionName[0] == '+')
-			{
-				std::string tag = conditionName.substr(1);
-
-				if (_parameters.count(tag))
-					conditionValue = !_parameters.at(tag).empty();
-				else if (_listParameters.count(tag))
-					conditionValue = !_listParameters.at(tag).empty();
-				else
-					assertThrow(false, WhiskersError, "Tag " + tag + " used as condition but was not set.");
-			}
-			else
-			{
-				assertThrow(
-					_conditions.count(conditionName),
-					WhiskersError, "Condition parameter " + conditionName + " not set."
-				);
-				conditionValue = _conditions.at(conditionName);
-			}
-			return replace(
-				conditionValue ? _match[5] : _match[7],
-				_parameters,
-				_conditions,
-				_listParameters
-			);
-		}
-	});
-}
-
-Whiskers::StringMap Whiskers::joinMaps(
-	Whiskers::StringMap const& _a,
-	Whiskers::StringMap const& _b
-)
-{
-	Whiskers::StringMap ret = _a;
-	for (auto const& x: _b)
-		assertThrow(
-			ret.insert(x).second,
-			WhiskersError,
-			"Parameter collision"
-		);
-	return ret;
-}
-
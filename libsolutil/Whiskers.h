@@ -26,8 +26,9 @@
 
 #include <libsolutil/Exceptions.h>
 
-#include <string>
 #include <map>
+#include <memory>
+#include <string>
 #include <vector>
 
 namespace solidity::util
@@ -90,6 +91,10 @@ public:
 	std::string render() const;
 
 private:
+	/// Template parsed into a sequence of text and tag nodes. Parsed templates are cached and shared
+	/// between all objects constructed from the same template string.
+	struct Template;
+
 	// Prevent implicit cast to bool
 	Whiskers& operator()(std::string _parameter, long long);
 	void checkTemplateValid() const;
@@ -102,19 +107,8 @@ private:
 	///        like `"<" + element + _parameter + ">"`. Each element of _prefixes is used as a prefix of the tag name.
 	void checkTemplateContainsTags(std::string const& _parameter, std::vector<std::string> const& _prefixes) const;
 
-	static std::string replace(
-		std::string const& _template,
-		StringMap const& _parameters,
-		std::map<std::string, bool> const& _conditions,
-		StringListMap const& _listParameters = StringListMap()
-	);
-
-	static std::string paramRegex() { return "[a-zA-Z0-9_$-]+"; }
-
-	/// Joins the two maps throwing an exception if two keys are equal.
-	static StringMap joinMaps(StringMap const& _a, StringMap const& _b);
-
 	std::string m_template;
+	std::shared_ptr<Template const> m_compiledTemplate;
 	StringMap m_parameters;
 	std::map<std::string, bool> m_conditions;
 	StringListMap m_listParameters;
@@ -83,18 +83,21 @@ public:
 		)
 	{}
 
+	/// @param _jobs maximum number of threads used by the evmasm optimiser.
 	YulStack(
 		langutil::EVMVersion _evmVersion,
 		std::optional<uint8_t> _eofVersion,
 		Language _language,
 		solidity::frontend::OptimiserSettings _optimiserSettings,
-		langutil::DebugInfoSelection const& _debugInfoSelection
+		langutil::DebugInfoSelection const& _debugInfoSelection,
+		size_t _jobs = 1
 	):
 		m_language(_language),
 		m_evmVersion(_evmVersion),
 		m_eofVersion(_eofVersion),
 		m_optimiserSettings(std::move(_optimiserSettings)),
 		m_debugInfoSelection(_debugInfoSelection),
+		m_jobs(_jobs),
 		m_errorReporter(m_errors)
 	{}
 
@@ -156,6 +159,7 @@ private:
 	std::optional<uint8_t> m_eofVersion;
 	solidity::frontend::OptimiserSettings m_optimiserSettings;
 	langutil::DebugInfoSelection m_debugInfoSelection{};
+	size_t m_jobs = 1;
 
 	std::unique_ptr<langutil::CharStream> m_charStream;
 
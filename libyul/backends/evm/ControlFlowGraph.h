@@ -166,6 +166,8 @@ struct CFG
 		/// Stack slots this operation leaves on the stack as output.
 		Stack output;
 		std::variant<FunctionCall, BuiltinCall, Assignment> operation;
+		/// Position of the operation among all operations of the graph, assigned once the graph is complete.
+		size_t index = 0;
 	};
 
 	struct FunctionInfo;
@@ -206,6 +208,8 @@ struct CFG
 		/// If the block starts a sub-graph and does not lead to a function return, we are free to add junk to it.
 		bool allowsJunk() const { return isStartOfSubGraph && !needsCleanStack; }
 		std::variant<MainExit, Jump, ConditionalJump, FunctionReturn, Terminated> exit = MainExit{};
+		/// Position of the block in ``CFG::blocks``, assigned once the graph is complete.
+		size_t index = 0;
 	};
 
 	struct FunctionInfo
@@ -229,6 +233,10 @@ struct CFG
 
 	/// Container for blocks for explicit ownership.
 	std::list<BasicBlock> blocks;
+	/// Total number of operations in all blocks. Together with ``blocks.size()`` this allows
+	/// storing per-block and per-operation data in flat tables indexed by ``BasicBlock::index``
+	/// and ``Operation::index``.
+	size_t operationCount = 0;
 	/// Container for generated variables for explicit ownership.
 	/// Ghost variables are generated to store switch conditions when transforming the control flow
 	/// of a switch to a sequence of conditional jumps.
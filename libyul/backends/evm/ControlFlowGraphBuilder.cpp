@@ -191,6 +191,19 @@ void markStartsOfSubGraphs(CFG& _cfg)
 	}
 }
 
+/// Assigns consecutive indices to all blocks and operations of the graph.
+void assignIndices(CFG& _cfg)
+{
+	size_t blockIndex = 0;
+	_cfg.operationCount = 0;
+	for (CFG::BasicBlock& block: _cfg.blocks)
+	{
+		block.index = blockIndex++;
+		for (CFG::Operation& operation: block.operations)
+			operation.index = _cfg.operationCount++;
+	}
+}
+
 /// Marks each block that needs to maintain a clean stack. That is each block that has an outgoing
 /// path to a function return.
 void markNeedsCleanStack(CFG& _cfg)
@@ -223,6 +236,7 @@ std::unique_ptr<CFG> ControlFlowGraphBuilder::build(
 	markRecursiveCalls(*result);
 	markStartsOfSubGraphs(*result);
 	markNeedsCleanStack(*result);
+	assignIndices(*result);
 
 	// TODO: It might be worthwhile to run some further simplifications on the graph itself here.
 	// E.g. if there is a jump to a node that has the jumping node as its only entry, the nodes can be fused, etc.
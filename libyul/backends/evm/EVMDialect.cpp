@@ -52,7 +52,7 @@ std::pair<YulString, BuiltinFunctionForEVM> createEVMFunction(
 	evmasm::Instruction _instruction
 )
 {
-	evmasm::InstructionInfo info = evmasm::instructionInfo(_instruction, _evmVersion);
+	evmasm::InstructionInfo const& info = evmasm::instructionInfo(_instruction, _evmVersion);
 	BuiltinFunctionForEVM f;
 	f.name = YulString{_name};
 	f.parameters.resize(static_cast<size_t>(info.args));
@@ -58,7 +58,7 @@ std::vector<StackTooDeepError> OptimizedEVMCodeTransform::run(
 		stackLayout
 	);
 	// Create initial entry layout.
-	optimizedCodeTransform.createStackLayout(debugDataOf(*dfg->entry), stackLayout.blockInfos.at(dfg->entry).entryLayout);
+	optimizedCodeTransform.createStackLayout(debugDataOf(*dfg->entry), stackLayout.blockInfo(*dfg->entry).entryLayout);
 	optimizedCodeTransform(*dfg->entry);
 	for (Scope::Function const* function: dfg->functions)
 		optimizedCodeTransform(dfg->functionInfo.at(function));
@@ -372,7 +372,7 @@ void OptimizedEVMCodeTransform::operator()(CFG::BasicBlock const& _block)
 	yulAssert(m_generated.insert(&_block).second, "");
 
 	m_assembly.setSourceLocation(originLocationOf(_block));
-	auto const& blockInfo = m_stackLayout.blockInfos.at(&_block);
+	auto const& blockInfo = m_stackLayout.blockInfo(_block);
 
 	// Assert that the stack is valid for entering the block.
 	assertLayoutCompatibility(m_stack, blockInfo.entryLayout);
@@ -386,7 +386,7 @@ void OptimizedEVMCodeTransform::operator()(CFG::BasicBlock const& _block)
 	for (auto const& operation: _block.operations)
 	{
 		// Create required layout for entering the operation.
-		createStackLayout(debugDataOf(operation.operation), m_stackLayout.operationEntryLayout.at(&operation));
+		createStackLayout(debugDataOf(operation.operation), m_stackLayout.operationEntryLayout(operation));
 
 		// Assert that we have the inputs of the operation on stack top.
 		yulAssert(static_cast<int>(m_stack.size()) == m_assembly.stackHeight(), "");
@@ -420,7 +420,7 @@ void OptimizedEVMCodeTransform::operator()(CFG::BasicBlock const& _block)
 		[&](CFG::BasicBlock::Jump const& _jump)
 		{
 			// Create the stack expected at the jump target.
-			createStackLayout(debugDataOf(_jump), m_stackLayout.blockInfos.at(_jump.target).entryLayout);
+			createStackLayout(debugDataOf(_jump), m_stackLayout.blockInfo(*_jump.target).entryLayout);
 
 			// If this is the only jump to the block, we do not need a label and can directly continue with the target block.
 			if (!m_blockLabels.count(_jump.target) && _jump.target->entries.size() == 1)
@@ -461,8 +461,8 @@ void OptimizedEVMCodeTransform::operator()(CFG::BasicBlock const& _block)
 			m_stack.pop_back();
 
 			// Assert that we have a valid stack for both jump targets.
-			assertLayoutCompatibility(m_stack, m_stackLayout.blockInfos.at(_conditionalJump.nonZero).entryLayout);
-			assertLayoutCompatibility(m_stack, m_stackLayout.blockInfos.at(_conditionalJump.zero).entryLayout);
+			assertLayoutCompatibility(m_stack, m_stackLayout.blockInfo(*_conditionalJump.nonZero).entryLayout);
+			assertLayoutCompatibility(m_stack, m_stackLayout.blockInfo(*_conditionalJump.zero).entryLayout);
 
 			{
 				// Restore the stack afterwards for the non-zero case below.
@@ -534,7 +534,7 @@ void OptimizedEVMCodeTransform::operator()(CFG::FunctionInfo const& _functionInf
 	m_assembly.appendLabel(getFunctionLabel(_functionInfo.function));
 
 	// Create the entry layout of the function body block and visit.
-	createStackLayout(debugDataOf(_functionInfo), m_stackLayout.blockInfos.at(_functionInfo.entry).entryLayout);
+	createStackLayout(debugDataOf(_functionInfo), m_stackLayout.blockInfo(*_functionInfo.entry).entryLayout);
 	(*this)(*_functionInfo.entry);
 
 	m_stack.clear();
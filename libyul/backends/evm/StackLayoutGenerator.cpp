@@ -49,7 +49,7 @@ using namespace solidity::yul;
 
 StackLayout StackLayoutGenerator::run(CFG const& _cfg)
 {
-	StackLayout stackLayout;
+	StackLayout stackLayout{_cfg};
 	StackLayoutGenerator{stackLayout, nullptr}.processEntryPoint(*_cfg.entry);
 
 	for (auto& functionInfo: _cfg.functionInfo | ranges::views::values)
@@ -60,17 +60,29 @@ StackLayout StackLayoutGenerator::run(CFG const& _cfg)
 
 std::map<YulString, std::vector<StackLayoutGenerator::StackTooDeep>> StackLayoutGenerator::reportStackTooDeep(CFG const& _cfg)
 {
+	// The subgraphs of the main entry point and of the functions are disjoint, so their layouts
+	// can be generated into the same tables without affecting each other.
+	StackLayout stackLayout{_cfg};
 	std::map<YulString, std::vector<StackLayoutGenerator::StackTooDeep>> stackTooDeepErrors;
-	stackTooDeepErrors[YulString{}] = reportStackTooDeep(_cfg, YulString{});
+
+	StackLayoutGenerator mainGenerator{stackLayout, nullptr};
+	mainGenerator.processEntryPoint(*_cfg.entry);
+	stackTooDeepErrors[YulString{}] = mainGenerator.reportStackTooDeep(*_cfg.entry);
+
 	for (auto const& function: _cfg.functions)
-		if (auto errors = reportStackTooDeep(_cfg, function->name); !errors.empty())
+	{
+		CFG::FunctionInfo const& functionInfo = _cfg.functionInfo.at(function);
+		StackLayoutGenerator generator{stackLayout, &functionInfo};
+		generator.processEntryPoint(*functionInfo.entry);
+		if (auto errors = generator.reportStackTooDeep(*functionInfo.entry); !errors.empty())
 			stackTooDeepErrors[function->name] = std::move(errors);
+	}
 	return stackTooDeepErrors;
 }
 
 std::vector<StackLayoutGenerator::StackTooDeep> StackLayoutGenerator::reportStackTooDeep(CFG const& _cfg, YulString _functionName)
 {
-	StackLayout stackLayout;
+	StackLayout stackLayout{_cfg};
 	CFG::FunctionInfo const* functionInfo = nullptr;
 	if (!_functionName.empty())
 	{
@@ -296,7 +308,7 @@ Stack StackLayoutGenerator::propagateStackThroughOperation(Stack _exitStack, CFG
 	// Store the exact desired operation entry layout. The stored layout will be recreated by the code transform
 	// before executing the operation. However, this recreation can produce slots that can be freely generated or
 	// are duplicated, i.e. we can compress the stack afterwards without causing problems for code generation later.
-	m_layout.operationEntryLayout[&_operation] = stack;
+	m_layout.operationEntryLayout(_operation) = stack;
 
 	// Remove anything from the stack top that can be freely generated or dupped from deeper on the stack.
 	while (!stack.empty())
@@ -355,7 +367,7 @@ void StackLayoutGenerator::processEntryPoint(CFG::BasicBlock const& _entry, CFG:
 			if (std::optional<Stack> exitLayout = getExitLayoutOrStageDependencies(*block, visited, toVisit))
 			{
 				visited.emplace(block);
-				auto& info = m_layout.blockInfos[block];
+				auto& info = m_layout.blockInfo(*block);
 				info.exitLayout = *exitLayout;
 				info.entryLayout = propagateStackThroughBlock(info.exitLayout, *block);
 
@@ -371,8 +383,8 @@ void StackLayoutGenerator::processEntryPoint(CFG::BasicBlock const& _entry, CFG:
 			// This block jumps backwards, but does not provide all slots required by the jump target on exit.
 			// Therefore we need to visit the subgraph between ``target`` and ``jumpingBlock`` again.
 			if (ranges::any_of(
-				m_layout.blockInfos[target].entryLayout,
-				[exitLayout = m_layout.blockInfos[jumpingBlock].exitLayout](StackSlot const& _slot) {
+				m_layout.blockInfo(*target).entryLayout,
+				[exitLayout = m_layout.blockInfo(*jumpingBlock).exitLayout](StackSlot const& _slot) {
 					return !util::contains(exitLayout, _slot);
 				}
 			))
@@ -424,13 +436,12 @@ std::optional<Stack> StackLayoutGenerator::getExitLayoutOrStageDependencies(
 			{
 				// Choose the best currently known entry layout of the jump target as initial exit.
 				// Note that this may not yet be the final layout.
-				if (auto* info = util::valueOrNullptr(m_layout.blockInfos, _jump.target))
-					return info->entryLayout;
-				return Stack{};
+				// Blocks that have not been visited yet still have an empty entry layout.
+				return m_layout.blockInfo(*_jump.target).entryLayout;
 			}
 			// If the current iteration has already visited the jump target, start from its entry layout.
 			if (_visited.count(_jump.target))
-				return m_layout.blockInfos.at(_jump.target).entryLayout;
+				return m_layout.blockInfo(*_jump.target).entryLayout;
 			// Otherwise stage the jump target for visit and defer the current block.
 			_toVisit.emplace_front(_jump.target);
 			return std::nullopt;
@@ -443,8 +454,8 @@ std::optional<Stack> StackLayoutGenerator::getExitLayoutOrStageDependencies(
 			{
 				// If the current iteration has already visited both jump targets, start from its entry layout.
 				Stack stack = combineStack(
-					m_layout.blockInfos.at(_conditionalJump.zero).entryLayout,
-					m_layout.blockInfos.at(_conditionalJump.nonZero).entryLayout
+					m_layout.blockInfo(*_conditionalJump.zero).entryLayout,
+					m_layout.blockInfo(*_conditionalJump.nonZero).entryLayout
 				);
 				// Additionally, the jump condition has to be at the stack top at exit.
 				stack.emplace_back(_conditionalJump.condition);
@@ -503,7 +514,7 @@ void StackLayoutGenerator::stitchConditionalJumps(CFG::BasicBlock const& _block)
 {
 	util::BreadthFirstSearch<CFG::BasicBlock const*> breadthFirstSearch{{&_block}};
 	breadthFirstSearch.run([&](CFG::BasicBlock const* _block, auto _addChild) {
-		auto& info = m_layout.blockInfos.at(_block);
+		auto& info = m_layout.blockInfo(*_block);
 		std::visit(util::GenericVisitor{
 			[&](CFG::BasicBlock::MainExit const&) {},
 			[&](CFG::BasicBlock::Jump const& _jump)
@@ -513,8 +524,8 @@ void StackLayoutGenerator::stitchConditionalJumps(CFG::BasicBlock const& _block)
 			},
 			[&](CFG::BasicBlock::ConditionalJump const& _conditionalJump)
 			{
-				auto& zeroTargetInfo = m_layout.blockInfos.at(_conditionalJump.zero);
-				auto& nonZeroTargetInfo = m_layout.blockInfos.at(_conditionalJump.nonZero);
+				auto& zeroTargetInfo = m_layout.blockInfo(*_conditionalJump.zero);
+				auto& nonZeroTargetInfo = m_layout.blockInfo(*_conditionalJump.nonZero);
 				Stack exitLayout = info.exitLayout;
 
 				// The last block must have produced the condition at the stack top.
@@ -637,11 +648,11 @@ std::vector<StackLayoutGenerator::StackTooDeep> StackLayoutGenerator::reportStac
 	std::vector<StackTooDeep> stackTooDeepErrors;
 	util::BreadthFirstSearch<CFG::BasicBlock const*> breadthFirstSearch{{&_entry}};
 	breadthFirstSearch.run([&](CFG::BasicBlock const* _block, auto _addChild) {
-		Stack currentStack = m_layout.blockInfos.at(_block).entryLayout;
+		Stack currentStack = m_layout.blockInfo(*_block).entryLayout;
 
 		for (auto const& operation: _block->operations)
 		{
-			Stack& operationEntry = m_layout.operationEntryLayout.at(&operation);
+			Stack& operationEntry = m_layout.operationEntryLayout(operation);
 
 			stackTooDeepErrors += findStackTooDeep(currentStack, operationEntry);
 			currentStack = operationEntry;
@@ -649,14 +660,14 @@ std::vector<StackLayoutGenerator::StackTooDeep> StackLayoutGenerator::reportStac
 				currentStack.pop_back();
 			currentStack += operation.output;
 		}
-		// Do not attempt to create the exit layout m_layout.blockInfos.at(_block).exitLayout here,
+		// Do not attempt to create the exit layout m_layout.blockInfo(*_block).exitLayout here,
 		// since the code generator will directly move to the target entry layout.
 
 		std::visit(util::GenericVisitor{
 			[&](CFG::BasicBlock::MainExit const&) {},
 			[&](CFG::BasicBlock::Jump const& _jump)
 			{
-				Stack const& targetLayout = m_layout.blockInfos.at(_jump.target).entryLayout;
+				Stack const& targetLayout = m_layout.blockInfo(*_jump.target).entryLayout;
 				stackTooDeepErrors += findStackTooDeep(currentStack, targetLayout);
 
 				if (!_jump.backwards)
@@ -665,8 +676,8 @@ std::vector<StackLayoutGenerator::StackTooDeep> StackLayoutGenerator::reportStac
 			[&](CFG::BasicBlock::ConditionalJump const& _conditionalJump)
 			{
 				for (Stack const& targetLayout: {
-					m_layout.blockInfos.at(_conditionalJump.zero).entryLayout,
-					m_layout.blockInfos.at(_conditionalJump.nonZero).entryLayout
+					m_layout.blockInfo(*_conditionalJump.zero).entryLayout,
+					m_layout.blockInfo(*_conditionalJump.nonZero).entryLayout
 				})
 					stackTooDeepErrors += findStackTooDeep(currentStack, targetLayout);
 
@@ -715,11 +726,11 @@ void StackLayoutGenerator::fillInJunk(CFG::BasicBlock const& _block, CFG::Functi
 	auto addJunkRecursive = [&](CFG::BasicBlock const* _entry, size_t _numJunk) {
 		util::BreadthFirstSearch<CFG::BasicBlock const*> breadthFirstSearch{{_entry}};
 		breadthFirstSearch.run([&](CFG::BasicBlock const* _block, auto _addChild) {
-			auto& blockInfo = m_layout.blockInfos.at(_block);
+			auto& blockInfo = m_layout.blockInfo(*_block);
 			blockInfo.entryLayout = Stack{_numJunk, JunkSlot{}} + std::move(blockInfo.entryLayout);
 			for (auto const& operation: _block->operations)
 			{
-				auto& operationEntryLayout = m_layout.operationEntryLayout.at(&operation);
+				auto& operationEntryLayout = m_layout.operationEntryLayout(operation);
 				operationEntryLayout = Stack{_numJunk, JunkSlot{}} + std::move(operationEntryLayout);
 			}
 			blockInfo.exitLayout = Stack{_numJunk, JunkSlot{}} + std::move(blockInfo.exitLayout);
@@ -801,7 +812,7 @@ void StackLayoutGenerator::fillInJunk(CFG::BasicBlock const& _block, CFG::Functi
 	{
 		size_t bestNumJunk = getBestNumJunk(
 			_functionInfo->parameters | ranges::views::reverse | ranges::to<Stack>,
-			m_layout.blockInfos.at(&_block).entryLayout
+			m_layout.blockInfo(_block).entryLayout
 		);
 		if (bestNumJunk > 0)
 			addJunkRecursive(&_block, bestNumJunk);
@@ -813,9 +824,9 @@ void StackLayoutGenerator::fillInJunk(CFG::BasicBlock const& _block, CFG::Functi
 	util::BreadthFirstSearch<CFG::BasicBlock const*>{{&_block}}.run([&](CFG::BasicBlock const* _block, auto _addChild) {
 		if (_block->allowsJunk())
 		{
-			auto& blockInfo = m_layout.blockInfos.at(_block);
+			auto& blockInfo = m_layout.blockInfo(*_block);
 			Stack entryLayout = blockInfo.entryLayout;
-			Stack const& nextLayout = _block->operations.empty() ? blockInfo.exitLayout : m_layout.operationEntryLayout.at(&_block->operations.front());
+			Stack const& nextLayout = _block->operations.empty() ? blockInfo.exitLayout : m_layout.operationEntryLayout(_block->operations.front());
 			if (entryLayout != nextLayout)
 			{
 				size_t bestNumJunk = getBestNumJunk(
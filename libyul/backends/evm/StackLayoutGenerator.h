@@ -24,6 +24,7 @@
 #include <libyul/backends/evm/ControlFlowGraph.h>
 
 #include <map>
+#include <vector>
 
 namespace solidity::yul
 {
@@ -37,11 +38,23 @@ struct StackLayout
 		/// The resulting stack layout after executing the block.
 		Stack exitLayout;
 	};
-	std::map<CFG::BasicBlock const*, BlockInfo> blockInfos;
-	/// For each operation the complete stack layout that:
+
+	explicit StackLayout(CFG const& _cfg):
+		blockInfos(_cfg.blocks.size()),
+		operationEntryLayouts(_cfg.operationCount)
+	{}
+
+	BlockInfo& blockInfo(CFG::BasicBlock const& _block) { return blockInfos.at(_block.index); }
+	BlockInfo const& blockInfo(CFG::BasicBlock const& _block) const { return blockInfos.at(_block.index); }
+	Stack& operationEntryLayout(CFG::Operation const& _operation) { return operationEntryLayouts.at(_operation.index); }
+	Stack const& operationEntryLayout(CFG::Operation const& _operation) const { return operationEntryLayouts.at(_operation.index); }
+
+	/// Block infos indexed by ``CFG::BasicBlock::index``.
+	std::vector<BlockInfo> blockInfos;
+	/// For each operation (indexed by ``CFG::Operation::index``) the complete stack layout that:
 	/// - has the slots required for the operation at the stack top.
 	/// - will have the operation result in a layout that makes it easy to achieve the next desired layout.
-	std::map<CFG::Operation const*, Stack> operationEntryLayout;
+	std::vector<Stack> operationEntryLayouts;
 };
 
 class StackLayoutGenerator
@@ -59,6 +72,7 @@ public:
 	/// @returns a map from function names to the stack too deep errors occurring in that function.
 	/// Requires @a _cfg to be a control flow graph generated from disambiguated Yul.
 	/// The empty string is mapped to the stack too deep errors of the main entry point.
+	/// The layouts of all entry points are generated at once and shared between the reports of the individual functions.
 	static std::map<YulString, std::vector<StackTooDeep>> reportStackTooDeep(CFG const& _cfg);
 	/// @returns all stack too deep errors in the function named @a _functionName.
 	/// Requires @a _cfg to be a control flow graph generated from disambiguated Yul.
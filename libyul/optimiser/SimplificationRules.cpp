@@ -249,7 +249,7 @@ Expression Pattern::toExpression(langutil::DebugData::ConstPtr const& _debugData
 		for (auto const& arg: m_arguments)
 			arguments.emplace_back(arg.toExpression(_debugData, _evmVersion));
 
-		std::string name = util::toLower(instructionInfo(m_instruction, _evmVersion).name);
+		std::string name = util::toLower(std::string(instructionInfo(m_instruction, _evmVersion).name));
 
 		return FunctionCall{_debugData,
 			Identifier{_debugData, YulString{name}},
@@ -21,6 +21,8 @@
 
 #include <libyul/optimiser/StackCompressor.h>
 
+#include <libyul/optimiser/ASTCopier.h>
+#include <libyul/optimiser/BlockHasher.h>
 #include <libyul/optimiser/NameCollector.h>
 #include <libyul/optimiser/Rematerialiser.h>
 #include <libyul/optimiser/UnusedPruner.h>
@@ -181,6 +183,119 @@ void eliminateVariables(
 	UnusedPruner::runUntilStabilised(_dialect, _ast, _allowMSizeOptimization, nullptr, allFunctions);
 }
 
+/**
+ * Determines the stack deficit of the main block and of each function like the CompilabilityChecker,
+ * but only re-checks the code that changed since the previous invocation and reuses the results
+ * for the rest.
+ *
+ * Changes are detected by comparing block hashes. A hash collision could only make us miss a
+ * remaining stack deficit, which would then be reported by the code transform.
+ *
+ * Prerequisite: Function Grouper
+ */
+class IncrementalCompilabilityChecker
+{
+public:
+	IncrementalCompilabilityChecker(Dialect const& _dialect, Object const& _object, bool _optimizeStackAllocation):
+		m_dialect(_dialect),
+		m_object(_object),
+		m_optimizeStackAllocation(_optimizeStackAllocation)
+	{}
+
+	/// @returns a mapping from function name (empty for the main block) to the stack deficit
+	/// of the function, with no entry present if the function is compilable.
+	std::map<YulString, int> const& stackDeficit()
+	{
+		std::map<YulString, uint64_t> codeHashes = hashCode();
+		std::set<YulString> changed;
+		for (auto const& [name, hash]: codeHashes)
+		{
+			auto it = m_codeHashes.find(name);
+			if (it == m_codeHashes.end() || it->second != hash)
+				changed.insert(name);
+		}
+		m_changed = !changed.empty();
+
+		if (m_codeHashes.empty())
+			m_stackDeficit = CompilabilityChecker(m_dialect, m_object, m_optimizeStackAllocation).stackDeficit;
+		else if (m_changed)
+		{
+			Object reducedObject = m_object;
+			reducedObject.code = std::make_shared<Block>(reducedCode(changed));
+			std::map<YulString, int> stackDeficit =
+				CompilabilityChecker(m_dialect, reducedObject, m_optimizeStackAllocation).stackDeficit;
+
+			// Results for functions that were replaced by stubs are meaningless, keep the previous ones.
+			for (YulString name: changed)
+				if (int const* deficit = util::valueOrNullptr(stackDeficit, name))
+					m_stackDeficit[name] = *deficit;
+				else
+					m_stackDeficit.erase(name);
+		}
+
+		m_codeHashes = std::move(codeHashes);
+		return m_stackDeficit;
+	}
+
+	/// @returns false if the code did not change between the last two invocations of stackDeficit().
+	bool changed() const { return m_changed; }
+
+private:
+	std::map<YulString, uint64_t> hashCode() const
+	{
+		std::map<YulString, uint64_t> codeHashes;
+		for (auto const& statement: m_object.code->statements)
+			if (auto const* function = std::get_if<FunctionDefinition>(&statement))
+				codeHashes[function->name] = blockHash(function->body);
+			else
+				codeHashes[YulString{}] = blockHash(std::get<Block>(statement));
+		return codeHashes;
+	}
+
+	/// @returns the hash of @a _block. The BlockHasher does not record empty blocks,
+	/// so they get a fixed hash.
+	static uint64_t blockHash(Block const& _block)
+	{
+		if (_block.statements.empty())
+			return 0;
+		return BlockHasher::run(_block).at(&_block);
+	}
+
+	/// @returns a copy of the code in which the main block and the functions not contained in @a _changed
+	/// have empty bodies, such that they can still be referenced but do not have to be transformed.
+	Block reducedCode(std::set<YulString> const& _changed) const
+	{
+		Block const& code = *m_object.code;
+		Block reduced{code.debugData, {}};
+		for (auto const& statement: code.statements)
+			if (auto const* function = std::get_if<FunctionDefinition>(&statement))
+			{
+				if (_changed.count(function->name))
+					reduced.statements.emplace_back(ASTCopier{}.translate(statement));
+				else
+					reduced.statements.emplace_back(FunctionDefinition{
+						function->debugData,
+						function->name,
+						function->parameters,
+						function->returnVariables,
+						Block{function->body.debugData, {}}
+					});
+			}
+			else if (_changed.count(YulString{}))
+				reduced.statements.emplace_back(ASTCopier{}.translate(statement));
+			else
+				reduced.statements.emplace_back(Block{std::get<Block>(statement).debugData, {}});
+		return reduced;
+	}
+
+	Dialect const& m_dialect;
+	Object const& m_object;
+	bool m_optimizeStackAllocation = false;
+	std::map<YulString, uint64_t> m_codeHashes;
+	std::map<YulString, int> m_stackDeficit;
+	bool m_changed = true;
+};
+
 void eliminateVariablesOptimizedCodegen(
 	Dialect const& _dialect,
 	Block& _ast,
@@ -258,19 +373,28 @@ bool StackCompressor::run(
 	{
 		yul::AsmAnalysisInfo analysisInfo = yul::AsmAnalyzer::analyzeStrictAssertCorrect(_dialect, _object);
 		std::unique_ptr<CFG> cfg = ControlFlowGraphBuilder::build(analysisInfo, _dialect, *_object.code);
+		std::map<YulString, std::vector<StackLayoutGenerator::StackTooDeep>> stackTooDeepErrors =
+			StackLayoutGenerator::reportStackTooDeep(*cfg);
+		if (std::all_of(stackTooDeepErrors.begin(), stackTooDeepErrors.end(), [](auto const& _item) { return _item.second.empty(); }))
+			return true;
 		eliminateVariablesOptimizedCodegen(
 			_dialect,
 			*_object.code,
-			StackLayoutGenerator::reportStackTooDeep(*cfg),
+			stackTooDeepErrors,
 			allowMSizeOptimization
 		);
 	}
 	else
+	{
+		IncrementalCompilabilityChecker compilabilityChecker(_dialect, _object, _optimizeStackAllocation);
 		for (size_t iterations = 0; iterations < _maxIterations; iterations++)
 		{
-			std::map<YulString, int> stackSurplus = CompilabilityChecker(_dialect, _object, _optimizeStackAllocation).stackDeficit;
+			std::map<YulString, int> stackSurplus = compilabilityChecker.stackDeficit();
 			if (stackSurplus.empty())
 				return true;
+			// Elimination is deterministic, so unchanged code will not become compilable in later iterations.
+			if (!compilabilityChecker.changed())
+				return false;
 			eliminateVariables(
 				_dialect,
 				*_object.code,
@@ -278,6 +402,7 @@ bool StackCompressor::run(
 				allowMSizeOptimization
 			);
 		}
+	}
 	return false;
 }
 
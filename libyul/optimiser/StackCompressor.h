@@ -46,6 +46,8 @@ class StackCompressor
 public:
 	/// Try to remove local variables until the AST is compilable.
 	/// @returns true if it was successful.
+	/// If the optimized code generator is used, variables are eliminated in a single pass and
+	/// true is only returned if there were no stack too deep errors, i.e. if the AST was left unchanged.
 	static bool run(
 		Dialect const& _dialect,
 		Object& _object,
@@ -200,14 +200,25 @@ void OptimiserSuite::run(
 		ConstantOptimiser{*evmDialect, *_meter}(ast);
 		if (usesOptimizedCodeGenerator)
 		{
-			StackCompressor::run(
+			bool compilable = StackCompressor::run(
 				_dialect,
 				_object,
 				_optimizeStackAllocation,
 				stackCompressorMaxIterations
 			);
 			if (evmDialect->providesObjectAccess())
-				StackLimitEvader::run(suite.m_context, _object);
+			{
+				if (compilable)
+					// The stack compressor did not find any stack too deep errors and did not modify the code,
+					// so there is no need to generate the stack layouts again.
+					StackLimitEvader::run(
+						suite.m_context,
+						_object,
+						std::map<YulString, std::vector<StackLayoutGenerator::StackTooDeep>>{{YulString{}, {}}}
+					);
+				else
+					StackLimitEvader::run(suite.m_context, _object);
+			}
 		}
 		else if (evmDialect->providesObjectAccess() && _optimizeStackAllocation)
 			StackLimitEvader::run(suite.m_context, _object);
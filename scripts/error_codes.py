@@ -206,6 +206,8 @@ def examine_id_coverage(top_dir, source_id_to_file_names, new_ids_only=False):
         "2339", # SMTChecker, covered by CL tests
         "2961", # SMTChecker, covered by CL tests
         "6240", # SMTChecker, covered by CL tests
+        "3916", # SMTChecker, only reported if the cache directory cannot be written
+        "4189", # Tested in test/libsolidity/ModelCheckerStatistics.cpp
     }
     assert len(test_ids & white_ids) == 0, "The sets are not supposed to intersect"
     test_ids |= white_ids
@@ -878,6 +878,10 @@ void CommandLineInterface::compile()
 		);
 
 		m_compiler->setOptimiserSettings(m_options.optimiserSettings());
+		m_compiler->enableTimings(m_options.compiler.timePasses);
+		m_compiler->setJobs(m_options.compiler.jobs);
+		if (m_options.compiler.gasMaxPaths)
+			m_compiler->setGasEstimationMaxPaths(*m_options.compiler.gasMaxPaths);
 
 		if (m_options.input.mode == InputMode::CompilerWithASTImport)
 		{
@@ -1327,6 +1331,13 @@ void CommandLineInterface::outputCompilationResults()
 		else
 			sout() << "Compiler run successful. No output generated." << std::endl;
 	}
+
+	// Printed last so that lazily generated artifacts like the metadata are included.
+	if (m_options.compiler.timePasses)
+	{
+		serr(false) << "Compiler timings:" << std::endl;
+		m_compiler->timings().print(serr(false));
+	}
 }
 
 void CommandLineInterface::report(langutil::Error::Severity _severity, std::string _message)
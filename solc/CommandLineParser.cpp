@@ -51,6 +51,7 @@ static std::string const g_strEOFVersion = "experimental-eof-version";
 static std::string const g_strViaIR = "via-ir";
 static std::string const g_strExperimentalViaIR = "experimental-via-ir";
 static std::string const g_strGas = "gas";
+static std::string const g_strGasMaxPaths = "gas-max-paths";
 static std::string const g_strHelp = "help";
 static std::string const g_strImportAst = "import-ast";
 static std::string const g_strImportEvmAssemblerJson = "import-asm-json";
@@ -59,6 +60,7 @@ static std::string const g_strYul = "yul";
 static std::string const g_strYulDialect = "yul-dialect";
 static std::string const g_strDebugInfo = "debug-info";
 static std::string const g_strIPFS = "ipfs";
+static std::string const g_strJobs = "jobs";
 static std::string const g_strLicense = "license";
 static std::string const g_strLibraries = "libraries";
 static std::string const g_strLink = "link";
@@ -67,12 +69,15 @@ static std::string const g_strMachine = "machine";
 static std::string const g_strNoCBORMetadata = "no-cbor-metadata";
 static std::string const g_strMetadataHash = "metadata-hash";
 static std::string const g_strMetadataLiteral = "metadata-literal";
+static std::string const g_strModelCheckerCacheDir = "model-checker-cache-dir";
 static std::string const g_strModelCheckerContracts = "model-checker-contracts";
 static std::string const g_strModelCheckerDivModNoSlacks = "model-checker-div-mod-no-slacks";
 static std::string const g_strModelCheckerEngine = "model-checker-engine";
 static std::string const g_strModelCheckerExtCalls = "model-checker-ext-calls";
 static std::string const g_strModelCheckerInvariants = "model-checker-invariants";
+static std::string const g_strModelCheckerJobs = "model-checker-jobs";
 static std::string const g_strModelCheckerPrintQuery = "model-checker-print-query";
+static std::string const g_strModelCheckerPrintStats = "model-checker-print-stats";
 static std::string const g_strModelCheckerShowProvedSafe = "model-checker-show-proved-safe";
 static std::string const g_strModelCheckerShowUnproved = "model-checker-show-unproved";
 static std::string const g_strModelCheckerShowUnsupported = "model-checker-show-unsupported";
@@ -91,6 +96,7 @@ static std::string const g_strOutputDir = "output-dir";
 static std::string const g_strOverwrite = "overwrite";
 static std::string const g_strRevertStrings = "revert-strings";
 static std::string const g_strStopAfter = "stop-after";
+static std::string const g_strTimePasses = "time-passes";
 static std::string const g_strParsing = "parsing";
 
 /// Possible arguments to for --revert-strings
@@ -248,6 +254,9 @@ bool CommandLineOptions::operator==(CommandLineOptions const& _other) const noex
 		formatting.withErrorIds == _other.formatting.withErrorIds &&
 		compiler.outputs == _other.compiler.outputs &&
 		compiler.estimateGas == _other.compiler.estimateGas &&
+		compiler.timePasses == _other.compiler.timePasses &&
+		compiler.jobs == _other.compiler.jobs &&
+		compiler.gasMaxPaths == _other.compiler.gasMaxPaths &&
 		compiler.combinedJsonRequests == _other.compiler.combinedJsonRequests &&
 		metadata.format == _other.metadata.format &&
 		metadata.hash == _other.metadata.hash &&
@@ -644,6 +653,13 @@ General Information)").c_str(),
 			po::value<std::string>()->value_name("stage"),
 			"Stop execution after the given compiler stage. Valid options: \"parsing\"."
 		)
+		(
+			g_strJobs.c_str(),
+			po::value<unsigned>()->value_name("n"),
+			"Set the number of threads used to parse the sources, to run the analysis steps "
+			"that can check source units independently and to optimize the EVM assembly. "
+			"The output is the same as with a single thread. The default is 1 and the maximum is 256."
+		)
 	;
 	desc.add(outputOptions);
 
@@ -769,6 +785,16 @@ General Information)").c_str(),
 			g_strGas.c_str(),
 			"Print an estimate of the maximal gas usage for each function."
 		)
+		(
+			g_strGasMaxPaths.c_str(),
+			po::value<unsigned>()->value_name("n"),
+			"Set the maximum number of execution paths explored to estimate the gas usage of a function. "
+			"Functions with more paths get an infinite estimate. The default is no limit."
+		)
+		(
+			g_strTimePasses.c_str(),
+			"Print the wall time and peak memory usage of each compiler phase to stderr."
+		)
 		(
 			g_strCombinedJson.c_str(),
 			po::value<std::string>()->value_name(util::joinHumanReadable(CombinedJsonRequests::componentMap() | ranges::views::keys, ",")),
@@ -829,6 +855,14 @@ General Information)").c_str(),
 
 	po::options_description smtCheckerOptions("Model Checker Options");
 	smtCheckerOptions.add_options()
+		(
+			g_strModelCheckerCacheDir.c_str(),
+			po::value<std::string>()->value_name("path"),
+			"Store the results of the model checker engines in the given directory"
+			" and report the stored results instead of analyzing the sources again if neither the sources,"
+			" the model checker settings, the EVM version, the solver version nor the compiler version changed."
+			" Has no effect if the smtlib2, eld or cvc5 solver is selected."
+		)
 		(
 			g_strModelCheckerContracts.c_str(),
 			po::value<std::string>()->value_name("default,<source>:<contract>")->default_value("default"),
@@ -859,10 +893,23 @@ General Information)").c_str(),
 			" Multiple types of invariants can be selected at the same time, separated by a comma and no spaces."
 			" By default no invariants are reported."
 		)
+		(
+			g_strModelCheckerJobs.c_str(),
+			po::value<unsigned>()->value_name("n"),
+			"Set the number of solver instances the CHC engine uses to solve verification targets"
+			" and the BMC engine uses to solve the verification conditions of a function concurrently."
+			" Results are reported in the same order as with a single instance."
+			" The default is 1 and the maximum is 256."
+		)
 		(
 			g_strModelCheckerPrintQuery.c_str(),
 			"Print the queries created by the SMTChecker in the SMTLIB2 format."
 		)
+		(
+			g_strModelCheckerPrintStats.c_str(),
+			"Print the number of Horn rules and relations, the SMTLIB2 size, the solving time"
+			" and the result of every query of the CHC engine as JSON."
+		)
 		(
 			g_strModelCheckerShowProvedSafe.c_str(),
 			"Show all targets that were proved safe separately."
@@ -995,11 +1042,14 @@ void CommandLineParser::processArgs()
 		{g_strMetadataLiteral, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
 		{g_strNoCBORMetadata, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
 		{g_strMetadataHash, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
+		{g_strModelCheckerCacheDir, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
 		{g_strModelCheckerContracts, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
 		{g_strModelCheckerDivModNoSlacks, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
 		{g_strModelCheckerEngine, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
 		{g_strModelCheckerInvariants, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
+		{g_strModelCheckerJobs, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
 		{g_strModelCheckerPrintQuery, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
+		{g_strModelCheckerPrintStats, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
 		{g_strModelCheckerShowProvedSafe, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
 		{g_strModelCheckerShowUnproved, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
 		{g_strModelCheckerShowUnsupported, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
@@ -1007,7 +1057,10 @@ void CommandLineParser::processArgs()
 		{g_strModelCheckerTimeout, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
 		{g_strModelCheckerBMCLoopIterations, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
 		{g_strModelCheckerContracts, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
-		{g_strModelCheckerTargets, {InputMode::Compiler, InputMode::CompilerWithASTImport}}
+		{g_strModelCheckerTargets, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
+		{g_strTimePasses, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
+		{g_strJobs, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
+		{g_strGasMaxPaths, {InputMode::Compiler, InputMode::CompilerWithASTImport}}
 	};
 	std::vector<std::string> invalidOptionsForCurrentInputMode;
 	for (auto const& [optionName, inputModes]: validOptionInputModeCombinations)
@@ -1143,6 +1196,29 @@ void CommandLineParser::processArgs()
 	parseOutputSelection();
 
 	m_options.compiler.estimateGas = (m_args.count(g_strGas) > 0);
+	m_options.compiler.timePasses = (m_args.count(g_strTimePasses) > 0);
+
+	if (m_args.count(g_strJobs))
+	{
+		unsigned jobs = m_args[g_strJobs].as<unsigned>();
+		if (jobs == 0)
+			solThrow(CommandLineValidationError, "Invalid option for --" + g_strJobs + ": the number of jobs must be positive.");
+		if (jobs > CompilerStack::c_maxJobs)
+			solThrow(
+				CommandLineValidationError,
+				"Invalid option for --" + g_strJobs + ": the number of jobs must not be greater than " +
+				std::to_string(CompilerStack::c_maxJobs) + "."
+			);
+		m_options.compiler.jobs = jobs;
+	}
+
+	if (m_args.count(g_strGasMaxPaths))
+	{
+		unsigned maxPaths = m_args[g_strGasMaxPaths].as<unsigned>();
+		if (maxPaths == 0)
+			solThrow(CommandLineValidationError, "Invalid option for --" + g_strGasMaxPaths + ": the number of paths must be positive.");
+		m_options.compiler.gasMaxPaths = maxPaths;
+	}
 
 	if (m_args.count(g_strBasePath))
 		m_options.input.basePath = m_args[g_strBasePath].as<std::string>();
@@ -1336,6 +1412,14 @@ void CommandLineParser::processArgs()
 		m_options.metadata.format = CompilerStack::MetadataFormat::NoMetadata;
 	}
 
+	if (m_args.count(g_strModelCheckerCacheDir))
+	{
+		std::string cacheDir = m_args[g_strModelCheckerCacheDir].as<std::string>();
+		if (cacheDir.empty())
+			solThrow(CommandLineValidationError, "Invalid option for --" + g_strModelCheckerCacheDir + ": the path must not be empty.");
+		m_options.modelChecker.settings.cacheDirectory = std::move(cacheDir);
+	}
+
 	if (m_args.count(g_strModelCheckerContracts))
 	{
 		std::string contractsStr = m_args[g_strModelCheckerContracts].as<std::string>();
@@ -1375,6 +1459,20 @@ void CommandLineParser::processArgs()
 		m_options.modelChecker.settings.invariants = *invs;
 	}
 
+	if (m_args.count(g_strModelCheckerJobs))
+	{
+		unsigned jobs = m_args[g_strModelCheckerJobs].as<unsigned>();
+		if (jobs == 0)
+			solThrow(CommandLineValidationError, "Invalid option for --" + g_strModelCheckerJobs + ": the number of jobs must be positive.");
+		if (jobs > CompilerStack::c_maxJobs)
+			solThrow(
+				CommandLineValidationError,
+				"Invalid option for --" + g_strModelCheckerJobs + ": the number of jobs must not be greater than " +
+				std::to_string(CompilerStack::c_maxJobs) + "."
+			);
+		m_options.modelChecker.settings.jobs = jobs;
+	}
+
 	if (m_args.count(g_strModelCheckerShowProvedSafe))
 		m_options.modelChecker.settings.showProvedSafe = true;
 
@@ -1400,6 +1498,9 @@ void CommandLineParser::processArgs()
 		m_options.modelChecker.settings.printQuery = true;
 	}
 
+	if (m_args.count(g_strModelCheckerPrintStats))
+		m_options.modelChecker.settings.printStats = true;
+
 	if (m_args.count(g_strModelCheckerTargets))
 	{
 		std::string targetsStr = m_args[g_strModelCheckerTargets].as<std::string>();
@@ -1421,11 +1522,14 @@ void CommandLineParser::processArgs()
 
 	m_options.metadata.literalSources = (m_args.count(g_strMetadataLiteral) > 0);
 	m_options.modelChecker.initialize =
+		m_args.count(g_strModelCheckerCacheDir) ||
 		m_args.count(g_strModelCheckerContracts) ||
 		m_args.count(g_strModelCheckerDivModNoSlacks) ||
 		m_args.count(g_strModelCheckerEngine) ||
 		m_args.count(g_strModelCheckerExtCalls) ||
 		m_args.count(g_strModelCheckerInvariants) ||
+		m_args.count(g_strModelCheckerJobs) ||
+		m_args.count(g_strModelCheckerPrintStats) ||
 		m_args.count(g_strModelCheckerShowProvedSafe) ||
 		m_args.count(g_strModelCheckerShowUnproved) ||
 		m_args.count(g_strModelCheckerShowUnsupported) ||
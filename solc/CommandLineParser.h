@@ -212,6 +212,9 @@ struct CommandLineOptions
 	{
 		CompilerOutputs outputs;
 		bool estimateGas = false;
+		bool timePasses = false;
+		size_t jobs = 1;
+		std::optional<size_t> gasMaxPaths;
 		std::optional<CombinedJsonRequests> combinedJsonRequests;
 	} compiler;
 
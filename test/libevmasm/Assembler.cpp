@@ -420,6 +420,47 @@ BOOST_AUTO_TEST_CASE(subobject_encode_decode)
 	BOOST_CHECK(assembly.decodeSubPath(assembly.encodeSubPath(subPath)) == subPath);
 }
 
+BOOST_AUTO_TEST_CASE(assembly_item_copies)
+{
+	u256 const large = (u256(1) << 255) + 7;
+	AssemblyItem push(large);
+	AssemblyItem pushCopy = push;
+	pushCopy.setData(large - 1);
+	BOOST_CHECK(push.data() == large);
+	BOOST_CHECK(pushCopy.data() == large - 1);
+	BOOST_CHECK(push != pushCopy);
+	BOOST_CHECK(pushCopy < push);
+
+	AssemblyItem verbatim(bytes{0x01, 0x02}, 1, 2);
+	AssemblyItem verbatimCopy = verbatim;
+	BOOST_CHECK(verbatimCopy == verbatim);
+	BOOST_CHECK(verbatimCopy.verbatimData() == (bytes{0x01, 0x02}));
+	BOOST_CHECK_EQUAL(verbatimCopy.arguments(), 1);
+	BOOST_CHECK_EQUAL(verbatimCopy.returnValues(), 2);
+	BOOST_CHECK(AssemblyItem(bytes{0x01, 0x02}, 1, 3) != verbatim);
+}
+
+BOOST_AUTO_TEST_CASE(instruction_info_consistent_with_mnemonics)
+{
+	for (unsigned opcode = 0; opcode < 256; ++opcode)
+	{
+		auto instruction = static_cast<Instruction>(opcode);
+		InstructionInfo const& info = instructionInfo(instruction, EVMVersion());
+		if (!isValidInstruction(instruction))
+		{
+			BOOST_CHECK_EQUAL(info.name, "<INVALID_INSTRUCTION: " + std::to_string(opcode) + ">");
+			BOOST_CHECK(info.gasPriceTier == Tier::Invalid);
+			continue;
+		}
+		BOOST_CHECK(info.gasPriceTier != Tier::Invalid);
+		BOOST_REQUIRE(c_instructions.count(std::string(info.name)));
+		BOOST_CHECK(c_instructions.at(std::string(info.name)) == instruction);
+		BOOST_CHECK(&instructionInfo(instruction, EVMVersion::london()) == &instructionInfo(instruction, EVMVersion::homestead()));
+	}
+	BOOST_CHECK_EQUAL(instructionInfo(Instruction::PREVRANDAO, EVMVersion::london()).name, "DIFFICULTY");
+	BOOST_CHECK_EQUAL(instructionInfo(Instruction::PREVRANDAO, EVMVersion::paris()).name, "PREVRANDAO");
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // end namespaces
@@ -24,6 +24,7 @@
 #include <test/Common.h>
 
 #include <libevmasm/CommonSubexpressionEliminator.h>
+#include <libevmasm/ConstantOptimiser.h>
 #include <libevmasm/PeepholeOptimiser.h>
 #include <libevmasm/Inliner.h>
 #include <libevmasm/JumpdestRemover.h>
@@ -1048,6 +1049,33 @@ BOOST_AUTO_TEST_CASE(peephole_pop_calldatasize)
 	BOOST_CHECK(items.empty());
 }
 
+BOOST_AUTO_TEST_CASE(peephole_rematch_unchanged_item_before_change)
+{
+	// The push does not match in the first call, but does once the item after it is replaced.
+	AssemblyItems items{
+		u256(1),
+		Instruction::SLOAD,
+		u256(5),
+		Instruction::CALLVALUE,
+		Instruction::POP,
+		Instruction::POP,
+		Instruction::JUMPDEST
+	};
+	AssemblyItems expectation{
+		u256(1),
+		Instruction::SLOAD,
+		Instruction::JUMPDEST
+	};
+	PeepholeOptimiser peepOpt(items);
+	BOOST_REQUIRE(peepOpt.optimise());
+	BOOST_REQUIRE(peepOpt.optimise());
+	BOOST_CHECK(!peepOpt.optimise());
+	BOOST_CHECK_EQUAL_COLLECTIONS(
+		items.begin(), items.end(),
+		expectation.begin(), expectation.end()
+	);
+}
+
 BOOST_AUTO_TEST_CASE(peephole_commutative_swap1)
 {
 	std::vector<Instruction> ops{
@@ -1308,6 +1336,120 @@ BOOST_AUTO_TEST_CASE(jumpdest_removal_subassemblies)
 	);
 }
 
+BOOST_AUTO_TEST_CASE(constant_optimiser_runs)
+{
+	// The representations of constants are shared between assemblies, but the choice
+	// still has to depend on the number of runs of each assembly.
+	EVMVersion evmVersion;
+	u256 const value("0x2af37bc000000000005");
+	auto optimisedItems = [&](size_t _runs) {
+		Assembly assembly{evmVersion, false, {}};
+		assembly.append(value);
+		assembly.append(u256(0));
+		assembly.append(Instruction::SSTORE);
+		ConstantOptimisationMethod::optimiseConstants(false, _runs, evmVersion, assembly);
+		return assembly.items();
+	};
+
+	AssemblyItems const literal{value, u256(0), Instruction::SSTORE};
+	BOOST_CHECK(optimisedItems(200000) == literal);
+	AssemblyItems const computed = optimisedItems(1);
+	BOOST_CHECK(computed.size() > literal.size());
+	BOOST_CHECK(optimisedItems(200000) == literal);
+	BOOST_CHECK(optimisedItems(1) == computed);
+}
+
+BOOST_AUTO_TEST_CASE(concurrent_subassembly_optimisation)
+{
+	// Optimising sub-assemblies concurrently has to produce the same result as optimising
+	// them one after another, also if a sub-assembly is shared by several assemblies.
+	Assembly::OptimiserSettings settings;
+	settings.runJumpdestRemover = true;
+	settings.runPeephole = true;
+	settings.runDeduplicate = true;
+	settings.runCSE = true;
+	settings.runConstantOptimiser = true;
+	settings.evmVersion = solidity::test::CommonOptions::get().evmVersion();
+
+	auto optimisedAssembly = [&](size_t _jobs) {
+		auto fillSub = [](Assembly& _assembly) {
+			auto t1 = _assembly.newTag();
+			_assembly.append(t1);
+			_assembly.append(u256(2));
+			_assembly.append(Instruction::JUMP);
+			auto t2 = _assembly.newTag();
+			_assembly.append(t2); // Identical to t1, will be unified.
+			_assembly.append(u256(2));
+			_assembly.append(Instruction::JUMP);
+			_assembly.append(_assembly.newTag()); // Unreferenced, will be removed.
+			_assembly.append(u256(3));
+			_assembly.append(u256(4));
+			_assembly.append(Instruction::ADD);
+			return std::make_pair(t1, t2);
+		};
+		AssemblyPointer shared = std::make_shared<Assembly>(settings.evmVersion, false, std::string{});
+		auto [sharedT1, sharedT2] = fillSub(*shared);
+
+		auto main = std::make_shared<Assembly>(settings.evmVersion, true, std::string{});
+		for (size_t i = 0; i < 3; ++i)
+		{
+			AssemblyPointer sub = std::make_shared<Assembly>(settings.evmVersion, false, std::string{});
+			auto [t1, t2] = fillSub(*sub);
+			size_t sharedId = static_cast<size_t>(sub->appendSubroutine(shared).data());
+			// Only the references of the first parent are taken into account for the shared sub-assembly.
+			sub->append((i == 0 ? sharedT2 : sharedT1).toSubAssemblyTag(sharedId));
+			size_t subId = static_cast<size_t>(main->appendSubroutine(sub).data());
+			main->append(t2.toSubAssemblyTag(subId));
+			main->append(t1.toSubAssemblyTag(subId));
+		}
+
+		Assembly::OptimiserSettings jobSettings = settings;
+		jobSettings.jobs = _jobs;
+		main->optimise(jobSettings);
+		return main->assemblyString();
+	};
+
+	std::string const sequential = optimisedAssembly(1);
+	for (size_t jobs: {2, 4, 8})
+		BOOST_CHECK_EQUAL(optimisedAssembly(jobs), sequential);
+}
+
+BOOST_AUTO_TEST_CASE(concurrent_cse_chunks)
+{
+	// Optimising the chunks of the common subexpression eliminator concurrently has to
+	// produce the same result as optimising them one after another.
+	Assembly::OptimiserSettings settings;
+	settings.runCSE = true;
+	settings.evmVersion = solidity::test::CommonOptions::get().evmVersion();
+
+	auto optimisedAssembly = [&](size_t _jobs) {
+		Assembly assembly{settings.evmVersion, false, {}};
+		for (size_t i = 0; i < 1000; ++i)
+		{
+			assembly.append(assembly.newTag());
+			assembly.append(u256(i));
+			if (i % 3 == 0)
+			{
+				// Simplified to a single push.
+				assembly.append(u256(2));
+				assembly.append(Instruction::ADD);
+			}
+			assembly.append(Instruction::DUP1);
+			assembly.append(Instruction::SSTORE);
+		}
+		size_t const itemCount = assembly.items().size();
+		Assembly::OptimiserSettings jobSettings = settings;
+		jobSettings.jobs = _jobs;
+		assembly.optimise(jobSettings);
+		BOOST_CHECK(assembly.items().size() < itemCount);
+		return assembly.assemblyString();
+	};
+
+	std::string const sequential = optimisedAssembly(1);
+	for (size_t jobs: {2, 4, 8})
+		BOOST_CHECK_EQUAL(optimisedAssembly(jobs), sequential);
+}
+
 BOOST_AUTO_TEST_CASE(cse_sub_zero)
 {
 	checkCSE({
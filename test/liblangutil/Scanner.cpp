@@ -824,6 +824,26 @@ BOOST_AUTO_TEST_CASE(irregular_line_breaks_in_single_line_comment)
 	}
 }
 
+BOOST_AUTO_TEST_CASE(line_breaks_at_any_offset_in_long_comments)
+{
+	// Comment bodies are skipped in blocks of several characters, so put the end at every offset of a block.
+	for (size_t length = 0; length < 20; ++length)
+	{
+		std::string body = std::string(length, 'x') + "\t\xC3\xA4 *" + std::string(length, '*');
+		TestScanner scanner("// " + body + "\n a /* " + body + " / */ b /*" + body);
+		BOOST_CHECK_EQUAL(scanner.currentToken(), Token::Identifier);
+		BOOST_CHECK_EQUAL(scanner.currentLiteral(), "a");
+		BOOST_CHECK_EQUAL(scanner.next(), Token::Identifier);
+		BOOST_CHECK_EQUAL(scanner.currentLiteral(), "b");
+		BOOST_CHECK_EQUAL(scanner.next(), Token::Illegal);
+		BOOST_CHECK_EQUAL(scanner.next(), Token::EOS);
+
+		TestScanner irregular("// " + body + "\xE2\x80\xA8");
+		BOOST_CHECK_EQUAL(irregular.currentToken(), Token::Illegal);
+		BOOST_CHECK_EQUAL(irregular.currentLocation().start, static_cast<int>(3 + body.size()));
+	}
+}
+
 BOOST_AUTO_TEST_CASE(regular_line_breaks_in_single_line_doc_comment)
 {
 	for (auto const& nl: {"\r", "\n", "\r\n"})
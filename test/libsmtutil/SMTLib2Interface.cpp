@@ -0,0 +1,133 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Unit tests for the serialisation of SMT expressions to SMT-LIB2.
+ */
+
+#include <libsmtutil/SMTLib2Interface.h>
+
+#include <boost/test/unit_test.hpp>
+
+namespace solidity::smtutil::test
+{
+
+BOOST_AUTO_TEST_SUITE(SMTLib2InterfaceTest)
+
+BOOST_AUTO_TEST_CASE(nested_query)
+{
+	auto tupleSort = std::make_shared<TupleSort>(
+		"pair",
+		std::vector<std::string>{"pair_first", "pair_second"},
+		std::vector<SortPointer>{SortProvider::sintSort, SortProvider::boolSort}
+	);
+	auto arraySort = std::make_shared<ArraySort>(SortProvider::sintSort, SortProvider::sintSort);
+
+	SMTLib2Interface smtlib2;
+	smtlib2.declareVariable("x", SortProvider::sintSort);
+	smtlib2.declareVariable("p", tupleSort);
+	smtlib2.declareVariable("a", arraySort);
+	Expression const x("x", {}, SortProvider::sintSort);
+	Expression const p("p", {}, tupleSort);
+	Expression const a("a", {}, arraySort);
+
+	Expression const bv = Expression::int2bv(x + Expression(size_t(1)), 8);
+	Expression const term = Expression::ite(
+		Expression::tuple_get(p, 1),
+		Expression::select(Expression::store(a, x, Expression::bv2int(bv, true)), Expression::tuple_get(p, 0)),
+		Expression::select(
+			Expression::const_array(Expression(std::make_shared<SortSort>(arraySort)), x * Expression(size_t(2))),
+			Expression::bv2int(bv & bv)
+		)
+	);
+	smtlib2.addAssertion(term > Expression(size_t(0)));
+	smtlib2.addAssertion(p == Expression::tuple_constructor(
+		Expression(std::make_shared<SortSort>(tupleSort)),
+		{x, Expression(true)}
+	));
+
+	std::string output = "prefix ";
+	smtlib2.toSExpr(term, output);
+	BOOST_CHECK_EQUAL(output, "prefix " + smtlib2.toSExpr(term));
+
+	// The text of the queries has to stay the same, since the query responses are keyed by its hash.
+	BOOST_CHECK_EQUAL(
+		smtlib2.dumpQuery({x}),
+		"(set-option :produce-models true)\n"
+		"(set-logic ALL)\n"
+		"(declare-fun |x| () Int)\n"
+		"(declare-datatypes ((|pair| 0)) (((|pair| (|pair_first| Int) (|pair_second| Bool)))))\n"
+		"(declare-fun |p| () |pair|)\n"
+		"(declare-fun |a| () (Array Int Int))\n"
+		"(assert (> (ite (|pair_second| p) (select (store a x (ite (= ((_ extract 7 7)(ite (>= (+ "
+		"x 1) 0) ((_ int2bv 8) (+ x 1)) (bvneg ((_ int2bv 8) (- (+ x 1)))))) #b0) (bv2nat (ite (>= "
+		"(+ x 1) 0) ((_ int2bv 8) (+ x 1)) (bvneg ((_ int2bv 8) (- (+ x 1)))))) (- (bv2nat (bvneg "
+		"(ite (>= (+ x 1) 0) ((_ int2bv 8) (+ x 1)) (bvneg ((_ int2bv 8) (- (+ x 1)))))))))) "
+		"(|pair_first| p)) (select ((as const (Array Int Int)) (* x 2)) (bv2nat (bvand (ite (>= (+ "
+		"x 1) 0) ((_ int2bv 8) (+ x 1)) (bvneg ((_ int2bv 8) (- (+ x 1))))) (ite (>= (+ x 1) 0) "
+		"((_ int2bv 8) (+ x 1)) (bvneg ((_ int2bv 8) (- (+ x 1))))))))) 0))\n"
+		"(assert (= p (|pair| x true)))\n"
+		"(declare-const |EVALEXPR_0| Int)\n"
+		"(assert (= |EVALEXPR_0| x))\n"
+		"(check-sat)\n"
+		"(get-value (|EVALEXPR_0| ))\n"
+	);
+}
+
+BOOST_AUTO_TEST_CASE(let_bind_shared_subterms)
+{
+	SMTLib2Interface smtlib2;
+	smtlib2.setLetBindSharedSubterms(true);
+	smtlib2.declareVariable("x", SortProvider::uintSort);
+	smtlib2.declareVariable("y", SortProvider::uintSort);
+	Expression const x("x", {}, SortProvider::uintSort);
+	Expression const y("y", {}, SortProvider::uintSort);
+
+	Expression const sum = x + x;
+	Expression const doubleSum = sum + sum;
+	BOOST_CHECK_EQUAL(
+		smtlib2.toSExpr(doubleSum + doubleSum),
+		"(let ((_let_0 (+ x x))) (let ((_let_1 (+ _let_0 _let_0))) (+ _let_1 _let_1)))"
+	);
+
+	// Subterms that do not refer to each other are bound by the same let.
+	Expression const product = y * y;
+	BOOST_CHECK_EQUAL(
+		smtlib2.toSExpr((sum + product) - (sum * product)),
+		"(let ((_let_0 (+ x x)) (_let_1 (* y y))) (- (+ _let_0 _let_1) (* _let_0 _let_1)))"
+	);
+
+	// Structurally equal subterms that are not shared are serialised as before.
+	Expression const unshared = (x + y) * (x + y);
+	BOOST_CHECK_EQUAL(smtlib2.toSExpr(unshared), "(* (+ x y) (+ x y))");
+}
+
+BOOST_AUTO_TEST_CASE(let_variables_avoid_used_names)
+{
+	SMTLib2Interface smtlib2;
+	smtlib2.setLetBindSharedSubterms(true);
+	smtlib2.declareVariable("_let_0", SortProvider::uintSort);
+	smtlib2.declareVariable("_let_1", SortProvider::uintSort);
+	Expression const x("_let_0", {}, SortProvider::uintSort);
+
+	Expression const sum = x + x;
+	BOOST_CHECK_EQUAL(smtlib2.toSExpr(sum * sum), "(let ((_let_2 (+ _let_0 _let_0))) (* _let_2 _let_2))");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
@@ -0,0 +1,101 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Unit tests for the translation of SMT expressions to z3.
+ */
+
+#ifdef HAVE_Z3
+
+#include <libsmtutil/Z3Interface.h>
+
+#include <boost/test/unit_test.hpp>
+
+namespace solidity::smtutil::test
+{
+
+namespace
+{
+
+/// @returns a term in which every level refers to the level below twice,
+/// so that translating it as a tree would take 2^@a _depth steps.
+Expression doublingTerm(Expression const& _leaf, size_t _depth)
+{
+	Expression term = _leaf;
+	for (size_t i = 0; i < _depth; ++i)
+		term = term + term;
+	return term;
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE(Z3InterfaceTest)
+
+BOOST_AUTO_TEST_CASE(shared_subterms_translated_once)
+{
+	if (!Z3Interface::available())
+		return;
+
+	Z3Interface z3;
+	z3.declareVariable("x", SortProvider::uintSort);
+	Expression const x("x", {}, SortProvider::uintSort);
+	Expression const term = doublingTerm(x, 20);
+
+	z3::expr translated = z3.toZ3Expr(term);
+	BOOST_CHECK_EQUAL(z3.translationCount(), 20);
+
+	// A copy shares all its subterms and reuses their translations.
+	Expression const copy = term;
+	BOOST_CHECK(z3::eq(z3.toZ3Expr(copy), translated));
+	BOOST_CHECK_EQUAL(z3.translationCount(), 20);
+
+	// A structurally equal term that shares nothing is translated again.
+	BOOST_CHECK(z3::eq(z3.toZ3Expr(doublingTerm(x, 20)), translated));
+	BOOST_CHECK_EQUAL(z3.translationCount(), 40);
+}
+
+BOOST_AUTO_TEST_CASE(translations_scoped_to_query)
+{
+	if (!Z3Interface::available())
+		return;
+
+	Z3Interface z3;
+	z3.declareVariable("x", SortProvider::uintSort);
+	Expression const x("x", {}, SortProvider::uintSort);
+	Expression const term = doublingTerm(x, 8);
+
+	z3.addAssertion(term >= Expression(size_t(0)));
+	z3.push();
+	z3.addAssertion(term == Expression(size_t(256)));
+	BOOST_CHECK_EQUAL(z3.translationCount(), 10);
+	auto [result, values] = z3.check({x});
+	BOOST_CHECK(result == CheckResult::SATISFIABLE);
+	BOOST_REQUIRE_EQUAL(values.size(), 1);
+	BOOST_CHECK_EQUAL(values[0], "1");
+	BOOST_CHECK_EQUAL(z3.translationCount(), 0);
+
+	z3.addAssertion(term == Expression(size_t(3)));
+	BOOST_CHECK_EQUAL(z3.translationCount(), 9);
+	z3.pop();
+	BOOST_CHECK_EQUAL(z3.translationCount(), 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
+
+#endif
@@ -40,13 +40,14 @@ namespace solidity::frontend::test
 class GasMeterTestFramework: public SolidityExecutionFramework
 {
 public:
-	void compile(std::string const& _sourceCode)
+	void compile(std::string const& _sourceCode, size_t _gasEstimationMaxPaths = std::numeric_limits<size_t>::max())
 	{
 		m_compiler.reset();
 		m_compiler.setSources({{"", "pragma solidity >=0.0;\n"
 				"// SPDX-License-Identifier: GPL-3.0\n" + _sourceCode}});
 		m_compiler.setOptimiserSettings(solidity::test::CommonOptions::get().optimize);
 		m_compiler.setEVMVersion(m_evmVersion);
+		m_compiler.setGasEstimationMaxPaths(_gasEstimationMaxPaths);
 		BOOST_REQUIRE_MESSAGE(m_compiler.compile(), "Compiling contract failed");
 	}
 
@@ -230,6 +231,74 @@ BOOST_AUTO_TEST_CASE(multiple_external_functions)
 	testRunTimeGas("g(uint256)", std::vector<bytes>{encodeArgs(2)});
 }
 
+BOOST_AUTO_TEST_CASE(reused_meter_and_exploration_budget)
+{
+	char const* sourceCode = R"(
+		contract test {
+			uint data;
+			uint data2;
+			function f(uint x) public {
+				if (x > 7)
+					data2 = 1;
+				else
+					data = 1;
+			}
+			function g() public returns (uint) {
+				return data2;
+			}
+		}
+	)";
+	compile(sourceCode);
+	AssemblyItems const& items = *m_compiler.runtimeAssemblyItems(m_compiler.lastContractName());
+
+	// Reusing a meter for several estimates gives the same results as a new meter for each of them.
+	GasEstimator estimator(m_evmVersion);
+	PathGasMeter meter = estimator.pathGasMeter(items);
+	for (std::string signature: {"f(uint256)", "g()", "f(uint256)"})
+	{
+		GasMeter::GasConsumption reused = estimator.functionalEstimation(meter, signature);
+		GasMeter::GasConsumption fresh = estimator.functionalEstimation(items, signature);
+		BOOST_REQUIRE(!fresh.isInfinite);
+		BOOST_CHECK(!reused.isInfinite);
+		BOOST_CHECK_EQUAL(reused.value, fresh.value);
+	}
+
+	// The estimate is infinite if the paths exceed the budget.
+	BOOST_CHECK(GasEstimator(m_evmVersion, 1).functionalEstimation(items, "f(uint256)").isInfinite);
+}
+
+BOOST_AUTO_TEST_CASE(gas_estimates_max_paths)
+{
+	// f has more than 256 paths, g only a few.
+	char const* sourceCode = R"(
+		contract test {
+			uint data;
+			function f(uint x) public {
+				if ((x & 1) != 0) data = 1;
+				if ((x & 2) != 0) data = 2;
+				if ((x & 4) != 0) data = 3;
+				if ((x & 8) != 0) data = 4;
+				if ((x & 16) != 0) data = 5;
+				if ((x & 32) != 0) data = 6;
+				if ((x & 64) != 0) data = 7;
+				if ((x & 128) != 0) data = 8;
+			}
+			function g() public returns (uint) {
+				return data;
+			}
+		}
+	)";
+	compile(sourceCode);
+	Json estimates = m_compiler.gasEstimates(m_compiler.lastContractName());
+	BOOST_CHECK_NE(estimates["external"]["f(uint256)"].get<std::string>(), "infinite");
+	BOOST_CHECK_NE(estimates["external"]["g()"].get<std::string>(), "infinite");
+
+	compile(sourceCode, 100);
+	estimates = m_compiler.gasEstimates(m_compiler.lastContractName());
+	BOOST_CHECK_EQUAL(estimates["external"]["f(uint256)"].get<std::string>(), "infinite");
+	BOOST_CHECK_NE(estimates["external"]["g()"].get<std::string>(), "infinite");
+}
+
 BOOST_AUTO_TEST_CASE(exponent_size)
 {
 	char const* sourceCode = R"(
@@ -25,9 +25,12 @@
 #include <test/Common.h>
 
 #include <liblangutil/Exceptions.h>
+#include <libsolidity/ast/ASTJsonExporter.h>
 #include <libsolidity/interface/CompilerStack.h>
 #include <libsolidity/interface/ImportRemapper.h>
 
+#include <libsolutil/JSON.h>
+
 #include <boost/test/unit_test.hpp>
 
 #include <string>
@@ -36,6 +39,40 @@
 namespace solidity::frontend::test
 {
 
+namespace
+{
+
+/// Parses and analyzes the sources, loading missing imports from @a _files.
+/// @returns the AST of all sources, the read requests and the errors as a single string.
+std::string parseWithJobs(
+	StringMap const& _sources,
+	StringMap const& _files,
+	size_t _jobs
+)
+{
+	std::string readRequests;
+	CompilerStack c([&](std::string const&, std::string const& _path) -> ReadCallback::Result {
+		readRequests += _path + "\n";
+		if (_files.count(_path))
+			return {true, _files.at(_path)};
+		return {false, "not found"};
+	});
+	c.setSources(_sources);
+	c.setEVMVersion(solidity::test::CommonOptions::get().evmVersion());
+	c.setJobs(_jobs);
+	c.parseAndAnalyze();
+
+	std::string result = readRequests;
+	if (c.state() >= CompilerStack::State::Parsed)
+		for (std::string const& sourceName: c.sourceNames())
+			result += util::jsonPrettyPrint(ASTJsonExporter(c.state(), c.sourceIndices()).toJson(c.ast(sourceName)));
+	for (auto const& error: c.errors())
+		result += langutil::Error::formatErrorType(error->type()) + ": " + *error->comment() + "\n";
+	return result;
+}
+
+}
+
 BOOST_AUTO_TEST_SUITE(SolidityImports)
 
 BOOST_AUTO_TEST_CASE(remappings)
@@ -112,6 +149,60 @@ BOOST_AUTO_TEST_CASE(context_dependent_remappings_order_independent_2)
 	BOOST_CHECK(c.compile());
 }
 
+BOOST_AUTO_TEST_CASE(concurrent_parsing)
+{
+	StringMap sources{
+		{"a.sol", "import \"lib/x.sol\"; import \"c.sol\"; contract A is X, C { function f() public { assembly { let x := 1 } } } pragma solidity >=0.0;"},
+		{"b.sol", "import \"lib/y.sol\"; import \"lib/x.sol\" as X2; contract B is Y { X2.X x; } pragma solidity >=0.0;"},
+		{"c.sol", "import \"lib/z.sol\"; contract C is Z {} pragma solidity >=0.0;"}
+	};
+	StringMap files{
+		{"lib/x.sol", "import \"lib/z.sol\"; contract X is Z { uint[] a; } pragma solidity >=0.0;"},
+		{"lib/y.sol", "import \"lib/w.sol\"; contract Y { modifier m() { _; } function g() m public { assembly { mstore(0, 1) } } } pragma solidity >=0.0;"},
+		{"lib/z.sol", "contract Z { struct S { uint x; } } pragma solidity >=0.0;"},
+		{"lib/w.sol", "contract W { event E(uint); } pragma solidity >=0.0;"}
+	};
+
+	std::string const expected = parseWithJobs(sources, files, 1);
+	for (size_t jobs: {size_t(2), size_t(3), size_t(8), CompilerStack::c_maxJobs})
+		BOOST_CHECK_EQUAL(parseWithJobs(sources, files, jobs), expected);
+
+	// Workers are only started for the source units that exist, so the maximal number of jobs is cheap.
+	StringMap const single{{"a.sol", "contract A {} pragma solidity >=0.0;"}};
+	BOOST_CHECK_EQUAL(parseWithJobs(single, {}, CompilerStack::c_maxJobs), parseWithJobs(single, {}, 1));
+
+	// Errors, including the ones of missing imports, are reported in the same order.
+	files["lib/w.sol"] = "contract W { function } pragma solidity >=0.0;";
+	files.erase("lib/z.sol");
+	std::string const expectedErrors = parseWithJobs(sources, files, 1);
+	BOOST_CHECK(expectedErrors.find("Error") != std::string::npos);
+	for (size_t jobs: {2, 3, 8})
+		BOOST_CHECK_EQUAL(parseWithJobs(sources, files, jobs), expectedErrors);
+}
+
+BOOST_AUTO_TEST_CASE(concurrent_analysis)
+{
+	// Errors of the steps that check source units concurrently are reported in the order of the sources.
+	StringMap sources{
+		{"a.sol", "/// @title A\n/// @author x\n/// @invalid\ncontract A {}"},
+		{"b.sol", "import \"a.sol\"; contract B is A { /// @return\n function f() public {} } pragma solidity >=0.0;"},
+		{"c.sol", "contract C { /// @inheritdoc\n function g() public {} } pragma solidity >=0.0;"}
+	};
+	std::string const expected = parseWithJobs(sources, {}, 1);
+	BOOST_CHECK(expected.find("Error") != std::string::npos);
+	for (size_t jobs: {2, 3, 8})
+		BOOST_CHECK_EQUAL(parseWithJobs(sources, {}, jobs), expected);
+
+	StringMap immutables{
+		{"a.sol", "contract A { int immutable a; constructor() { a = 5; } function f() public { --a; } } pragma solidity >=0.0;"},
+		{"b.sol", "import \"a.sol\"; contract B is A { int immutable b = 1; function g() public { a++; } } pragma solidity >=0.0;"}
+	};
+	std::string const expectedImmutables = parseWithJobs(immutables, {}, 1);
+	BOOST_CHECK(expectedImmutables.find("TypeError") != std::string::npos);
+	for (size_t jobs: {2, 3, 8})
+		BOOST_CHECK_EQUAL(parseWithJobs(immutables, {}, jobs), expectedImmutables);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // end namespaces
@@ -0,0 +1,266 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Unit tests for the on-disk store of model checker results.
+ */
+
+#include <libsolidity/formal/ModelCheckerCache.h>
+#include <libsolidity/interface/CompilerStack.h>
+
+#include <libsolutil/CommonIO.h>
+#include <libsolutil/JSON.h>
+#include <libsolutil/Keccak256.h>
+#include <libsolutil/TemporaryDirectory.h>
+
+#include <boost/filesystem.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <fstream>
+#include <optional>
+
+using namespace solidity::langutil;
+using namespace solidity::util;
+
+namespace solidity::frontend::test
+{
+
+namespace
+{
+
+std::vector<boost::filesystem::path> cacheEntries(boost::filesystem::path const& _directory)
+{
+	std::vector<boost::filesystem::path> entries;
+	for (auto const& entry: boost::filesystem::directory_iterator(_directory))
+		entries.push_back(entry.path());
+	return entries;
+}
+
+ErrorList compileWithCache(
+	std::map<std::string, std::string> const& _sources,
+	std::optional<boost::filesystem::path> const& _cacheDirectory,
+	EVMVersion _evmVersion = EVMVersion()
+)
+{
+	ModelCheckerSettings settings;
+	settings.engine = ModelCheckerEngine::All();
+	if (_cacheDirectory)
+		settings.cacheDirectory = _cacheDirectory->string();
+
+	CompilerStack compiler;
+	compiler.setSources(_sources);
+	compiler.setEVMVersion(_evmVersion);
+	compiler.setModelCheckerSettings(settings);
+	BOOST_REQUIRE(compiler.parseAndAnalyze());
+	return compiler.errors();
+}
+
+ErrorList compileWithCache(std::string const& _source, boost::filesystem::path const& _cacheDirectory)
+{
+	return compileWithCache({{"A.sol", _source}}, _cacheDirectory);
+}
+
+/// @returns the errors in the format used by the command-line interface, including their locations.
+std::vector<std::string> formatErrors(ErrorList const& _errors)
+{
+	std::vector<std::string> formatted;
+	for (auto const& error: _errors)
+	{
+		std::string location;
+		if (SourceLocation const* sourceLocation = error->sourceLocation())
+			location = (sourceLocation->sourceName ? *sourceLocation->sourceName : "") + ":" +
+				std::to_string(sourceLocation->start) + ":" + std::to_string(sourceLocation->end);
+		formatted.push_back(
+			Error::formatErrorType(error->type()) + " " + std::to_string(error->errorId().error) + " " +
+			location + ": " + *error->comment()
+		);
+	}
+	return formatted;
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE(ModelCheckerCacheTest)
+
+BOOST_AUTO_TEST_CASE(store_and_load)
+{
+	TemporaryDirectory tempDir("smt-cache-test-");
+	ModelCheckerCache cache(tempDir.path() / "cache");
+	h256 fingerprint = keccak256("entry");
+
+	BOOST_CHECK(!cache.load(fingerprint));
+
+	auto sourceName = std::make_shared<std::string const>("A.sol");
+	ModelCheckerCache::Entry entry{{
+		std::make_shared<Error>(7737_error, Error::Type::Warning, "unsupported", SourceLocation{1, 2, sourceName}),
+		std::make_shared<Error>(
+			6328_error,
+			Error::Type::Warning,
+			"violation",
+			SourceLocation{3, 5, sourceName},
+			SecondarySourceLocation().append("counterexample", SourceLocation{})
+		),
+		std::make_shared<Error>(1391_error, Error::Type::Info, "proved safe")
+	}};
+	BOOST_REQUIRE(cache.store(fingerprint, entry));
+
+	std::optional<ModelCheckerCache::Entry> loaded = cache.load(fingerprint);
+	BOOST_REQUIRE(loaded);
+	BOOST_REQUIRE_EQUAL(loaded->errors.size(), 3);
+
+	Error const& unsupported = *loaded->errors[0];
+	BOOST_CHECK(unsupported.errorId() == 7737_error);
+	BOOST_CHECK(unsupported.type() == Error::Type::Warning);
+	BOOST_CHECK_EQUAL(*unsupported.comment(), "unsupported");
+	BOOST_REQUIRE(unsupported.sourceLocation());
+	BOOST_CHECK(*unsupported.sourceLocation() == (SourceLocation{1, 2, sourceName}));
+
+	Error const& violation = *loaded->errors[1];
+	BOOST_CHECK(violation.errorId() == 6328_error);
+	BOOST_REQUIRE(violation.secondarySourceLocation());
+	BOOST_REQUIRE_EQUAL(violation.secondarySourceLocation()->infos.size(), 1);
+	BOOST_CHECK_EQUAL(violation.secondarySourceLocation()->infos[0].first, "counterexample");
+
+	Error const& provedSafe = *loaded->errors[2];
+	BOOST_CHECK(provedSafe.type() == Error::Type::Info);
+	BOOST_CHECK(!provedSafe.sourceLocation());
+}
+
+BOOST_AUTO_TEST_CASE(invalid_entry)
+{
+	TemporaryDirectory tempDir("smt-cache-test-");
+	ModelCheckerCache cache(tempDir.path());
+	h256 fingerprint = keccak256("entry");
+	BOOST_REQUIRE(cache.store(fingerprint, {}));
+	BOOST_REQUIRE_EQUAL(cacheEntries(tempDir.path()).size(), 1);
+
+	std::ofstream(cacheEntries(tempDir.path())[0].string(), std::ios::trunc) << "{\"errors\": [";
+	BOOST_CHECK(!cache.load(fingerprint));
+}
+
+BOOST_AUTO_TEST_CASE(reports_stored_results)
+{
+	std::string const source = R"(
+		contract C {
+			function f(uint x) public pure {
+				assert(x > 0);
+			}
+		}
+	)";
+	TemporaryDirectory tempDir("smt-cache-test-");
+
+	ErrorList analyzed = compileWithCache(source, tempDir.path());
+	BOOST_REQUIRE(!analyzed.empty());
+	std::vector<boost::filesystem::path> entries = cacheEntries(tempDir.path());
+	BOOST_REQUIRE_EQUAL(entries.size(), 1);
+
+	// Unchanged inputs reproduce the same diagnostics.
+	ErrorList replayed = compileWithCache(source, tempDir.path());
+	BOOST_REQUIRE_EQUAL(replayed.size(), analyzed.size());
+	for (size_t i = 0; i < analyzed.size(); ++i)
+	{
+		BOOST_CHECK(replayed[i]->errorId() == analyzed[i]->errorId());
+		BOOST_CHECK_EQUAL(*replayed[i]->comment(), *analyzed[i]->comment());
+	}
+
+	// The diagnostics really come from the store rather than from a new analysis.
+	Json entry;
+	BOOST_REQUIRE(jsonParseStrict(readFileAsString(entries[0]), entry));
+	BOOST_REQUIRE(!entry["errors"].empty());
+	entry["errors"][0]["message"] = "From the cache.";
+	std::ofstream(entries[0].string(), std::ios::trunc) << jsonCompactPrint(entry);
+	ErrorList fromCache = compileWithCache(source, tempDir.path());
+	BOOST_REQUIRE(!fromCache.empty());
+	BOOST_CHECK(std::any_of(fromCache.begin(), fromCache.end(), [](auto const& _error) {
+		return *_error->comment() == "From the cache.";
+	}));
+
+	// A changed source unit is analyzed again and stored separately.
+	compileWithCache(source + "\ncontract D {}\n", tempDir.path());
+	BOOST_CHECK_EQUAL(cacheEntries(tempDir.path()).size(), 2);
+
+	// So is a compilation for a different EVM version.
+	compileWithCache({{"A.sol", source}}, tempDir.path(), EVMVersion::london());
+	BOOST_CHECK_EQUAL(cacheEntries(tempDir.path()).size(), 3);
+}
+
+BOOST_AUTO_TEST_CASE(multiple_sources_match_uncached_analysis)
+{
+	// B.sol and C.sol contain the targets of A.sol through inheritance, so the results
+	// of each source unit depend on the targets already solved for the ones before it.
+	std::map<std::string, std::string> sources{
+		{"A.sol", R"(
+			contract A {
+				function f(uint x) public pure {
+					assert(x > 0);
+					require(x > 5);
+					assert(x > 2);
+				}
+			}
+		)"},
+		{"B.sol", R"(
+			import "A.sol";
+			contract B is A {
+				function g(uint y) public pure {
+					assert(y != 7);
+				}
+			}
+		)"},
+		{"C.sol", R"(
+			import "B.sol";
+			contract C is B {
+				function h(uint z) public pure {
+					require(z > 2);
+					assert(z > 1);
+				}
+			}
+		)"}
+	};
+	TemporaryDirectory tempDir("smt-cache-test-");
+
+	std::vector<std::string> uncached = formatErrors(compileWithCache(sources, std::nullopt));
+	BOOST_REQUIRE(!uncached.empty());
+	BOOST_CHECK(formatErrors(compileWithCache(sources, tempDir.path())) == uncached);
+	BOOST_REQUIRE_EQUAL(cacheEntries(tempDir.path()).size(), 1);
+	BOOST_CHECK(formatErrors(compileWithCache(sources, tempDir.path())) == uncached);
+
+	// Changing one source unit must not mix its new results with stored ones of the others.
+	sources["B.sol"] += "\ncontract D { function k(uint w) public pure { assert(w > 3); } }\n";
+	uncached = formatErrors(compileWithCache(sources, std::nullopt));
+	BOOST_CHECK(formatErrors(compileWithCache(sources, tempDir.path())) == uncached);
+	BOOST_CHECK_EQUAL(cacheEntries(tempDir.path()).size(), 2);
+	BOOST_CHECK(formatErrors(compileWithCache(sources, tempDir.path())) == uncached);
+}
+
+BOOST_AUTO_TEST_CASE(callback_solvers_disable_cache)
+{
+	ModelCheckerSettings settings;
+	settings.cacheDirectory = "cache";
+	BOOST_CHECK(ModelCheckerCache::canCache(settings));
+
+	settings.solvers = *smtutil::SMTSolverChoice::fromString("z3,eld");
+	BOOST_CHECK(!ModelCheckerCache::canCache(settings));
+	settings.solvers = smtutil::SMTSolverChoice::CVC5();
+	BOOST_CHECK(!ModelCheckerCache::canCache(settings));
+	settings.solvers = smtutil::SMTSolverChoice::SMTLIB2();
+	BOOST_CHECK(!ModelCheckerCache::canCache(settings));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
@@ -0,0 +1,135 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Unit tests for the CHC statistics reported with the printStats setting.
+ */
+
+#include <libsolidity/formal/ModelChecker.h>
+#include <libsolidity/interface/CompilerStack.h>
+
+#include <libsolutil/JSON.h>
+
+#include <boost/test/unit_test.hpp>
+
+#include <set>
+
+using namespace solidity::langutil;
+using namespace solidity::util;
+
+namespace solidity::frontend::test
+{
+
+namespace
+{
+
+/// @returns the parsed JSON of the single statistics info reported for @a _source.
+Json chcStatistics(std::string const& _source)
+{
+	ModelCheckerSettings settings;
+	settings.engine = ModelCheckerEngine::CHC();
+	settings.targets = *ModelCheckerTargets::fromString("assert");
+	settings.printStats = true;
+
+	CompilerStack compiler;
+	compiler.setSources({{"A.sol", _source}});
+	compiler.setModelCheckerSettings(settings);
+	BOOST_REQUIRE(compiler.parseAndAnalyze());
+
+	std::string const prefix = "CHC: Statistics:\n";
+	std::optional<std::string> statistics;
+	for (auto const& error: compiler.errors())
+		if (error->errorId() == 4189_error)
+		{
+			BOOST_REQUIRE(!statistics);
+			BOOST_CHECK(error->type() == Error::Type::Info);
+			BOOST_REQUIRE(error->comment()->substr(0, prefix.size()) == prefix);
+			statistics = error->comment()->substr(prefix.size());
+		}
+	BOOST_REQUIRE(statistics);
+
+	Json output;
+	std::string parseErrors;
+	BOOST_REQUIRE_MESSAGE(jsonParseStrict(*statistics, output, &parseErrors), parseErrors);
+	return output;
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE(ModelCheckerStatisticsTest)
+
+BOOST_AUTO_TEST_CASE(targets)
+{
+	if (!ModelChecker::availableSolvers().z3)
+	{
+		BOOST_TEST_MESSAGE("z3 is not available, skipping.");
+		return;
+	}
+
+	std::string const source = R"(
+		contract C {
+			function f(uint x) public pure {
+				require(x > 10);
+				assert(x > 5);
+				assert(x > 20);
+			}
+		}
+	)";
+	Json output = chcStatistics(source);
+
+	std::set<std::string> const expectedKeys{
+		"target", "source", "start", "end", "rules", "targetRules", "relations",
+		"maxPredicateArity", "queryBytes", "wallTimeMicroseconds", "result"
+	};
+	std::vector<std::pair<std::string, std::string>> const expectedTargets{
+		{"assert(x > 5)", "safe"},
+		{"assert(x > 20)", "unsafe"}
+	};
+
+	BOOST_REQUIRE(output.is_object());
+	BOOST_REQUIRE_EQUAL(output.size(), 1);
+	BOOST_REQUIRE(output["targets"].is_array());
+	BOOST_REQUIRE_EQUAL(output["targets"].size(), expectedTargets.size());
+	for (size_t i = 0; i < expectedTargets.size(); ++i)
+	{
+		Json const& target = output["targets"][i];
+		BOOST_REQUIRE(target.is_object());
+
+		std::set<std::string> keys;
+		for (auto const& [key, value]: target.items())
+			keys.insert(key);
+		BOOST_CHECK(keys == expectedKeys);
+
+		auto const& [statement, result] = expectedTargets[i];
+		size_t start = source.find(statement);
+		BOOST_CHECK_EQUAL(target["target"].get<std::string>(), "assert");
+		BOOST_CHECK_EQUAL(target["source"].get<std::string>(), "A.sol");
+		BOOST_CHECK_EQUAL(target["start"].get<size_t>(), start);
+		BOOST_CHECK_EQUAL(target["end"].get<size_t>(), start + statement.size());
+		BOOST_CHECK_GT(target["rules"].get<size_t>(), 0);
+		BOOST_CHECK_GT(target["targetRules"].get<size_t>(), 0);
+		BOOST_CHECK_LE(target["targetRules"].get<size_t>(), target["rules"].get<size_t>());
+		BOOST_CHECK_GT(target["relations"].get<size_t>(), 0);
+		BOOST_CHECK_GT(target["maxPredicateArity"].get<size_t>(), 0);
+		BOOST_CHECK_GT(target["queryBytes"].get<size_t>(), 0);
+		BOOST_CHECK_EQUAL(target["result"].get<std::string>(), result);
+	}
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
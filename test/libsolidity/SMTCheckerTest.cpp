@@ -132,6 +132,11 @@ SMTCheckerTest::SMTCheckerTest(std::string const& _filename): SyntaxTest(_filena
 
 	auto const& bmcLoopIterations = m_reader.sizetSetting("BMCLoopIterations", 1);
 	m_modelCheckerSettings.bmcLoopIterations = std::optional<unsigned>{bmcLoopIterations};
+
+	auto const& jobs = m_reader.sizetSetting("SMTJobs", 1);
+	if (jobs == 0)
+		BOOST_THROW_EXCEPTION(std::runtime_error("Invalid number of SMT jobs."));
+	m_modelCheckerSettings.jobs = static_cast<unsigned>(jobs);
 }
 
 void SMTCheckerTest::setupCompiler(CompilerStack& _compiler)
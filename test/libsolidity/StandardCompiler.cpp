@@ -1656,6 +1656,57 @@ BOOST_AUTO_TEST_CASE(stopAfter_ast_output)
 	BOOST_CHECK(result["sources"]["a.sol"]["ast"].is_object());
 }
 
+BOOST_AUTO_TEST_CASE(compiler_timings)
+{
+	char const* input = R"(
+	{
+		"language": "Solidity",
+		"sources": {
+			"a.sol": {
+				"content": "// SPDX-License-Identifier: GPL-3.0\ncontract C { function f() public pure {} }"
+			}
+		},
+		"settings": {
+			"outputSelection": { "*": { "": [ "compilerTimings" ], "*": [ "evm.bytecode.object", "metadata" ] } }
+		}
+	}
+	)";
+	Json result = compile(input);
+	BOOST_CHECK(containsAtMostWarnings(result));
+	BOOST_REQUIRE(result["compilerTimings"].is_array());
+
+	std::set<std::string> phases;
+	for (auto const& entry: result["compilerTimings"])
+	{
+		BOOST_REQUIRE(entry["phase"].is_string());
+		BOOST_CHECK(entry["wallTimeMicroseconds"].is_number_integer());
+		BOOST_CHECK(entry["peakRSSKilobytes"].is_number_integer());
+		phases.insert(entry["phase"].get<std::string>());
+	}
+	for (std::string phase: {"parsing", "resolveImports", "analysis.typeChecker", "legacyCodegen", "assemble", "metadata"})
+		BOOST_CHECK_MESSAGE(phases.count(phase), "Missing phase " + phase);
+}
+
+BOOST_AUTO_TEST_CASE(compiler_timings_not_matched_by_wildcard)
+{
+	char const* input = R"(
+	{
+		"language": "Solidity",
+		"sources": {
+			"a.sol": {
+				"content": "// SPDX-License-Identifier: GPL-3.0\ncontract C { function f() public pure {} }"
+			}
+		},
+		"settings": {
+			"outputSelection": { "*": { "": [ "*" ], "*": [ "*" ] } }
+		}
+	}
+	)";
+	Json result = compile(input);
+	BOOST_CHECK(containsAtMostWarnings(result));
+	BOOST_CHECK(!result.contains("compilerTimings"));
+}
+
 BOOST_AUTO_TEST_CASE(dependency_tracking_of_abstract_contract)
 {
 	char const* input = R"(
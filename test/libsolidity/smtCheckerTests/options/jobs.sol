@@ -0,0 +1,20 @@
+contract C {
+	uint constant a = 89;
+	function f() public pure {
+		uint x = a;
+		assert(x == 89); // should hold
+		assert(x == 88); // should fail
+	}
+	function g(uint y) public pure {
+		require(y > 10);
+		assert(y > 5); // should hold
+		assert(y > 20); // should fail
+	}
+}
+// ====
+// SMTEngine: chc
+// SMTJobs: 3
+// ----
+// Warning 6328: (114-129): CHC: Assertion violation happens here.
+// Warning 6328: (236-250): CHC: Assertion violation happens here.
+// Info 1391: CHC: 2 verification condition(s) proved safe! Enable the model checker option "show proved safe" to see all of them.
@@ -0,0 +1,21 @@
+contract C {
+	uint constant a = 89;
+	function f() public pure {
+		uint x = a;
+		assert(x == 89); // should hold
+		assert(x == 88); // should fail
+	}
+	function g(uint y) public pure {
+		require(y > 10);
+		assert(y > 5); // should hold
+		assert(y > 20); // should fail
+	}
+}
+// ====
+// SMTEngine: bmc
+// SMTSolvers: z3
+// SMTJobs: 3
+// ----
+// Warning 4661: (114-129): BMC: Assertion violation happens here.
+// Warning 4661: (236-250): BMC: Assertion violation happens here.
+// Info 6002: BMC: 2 verification condition(s) proved safe! Enable the model checker option "show proved safe" to see all of them.
@@ -240,6 +240,65 @@ BOOST_AUTO_TEST_CASE(invalid_param_rendered)
 	BOOST_CHECK_EQUAL(m.render(), templ);
 }
 
+BOOST_AUTO_TEST_CASE(first_closing_tag_ends_block)
+{
+	BOOST_CHECK_EQUAL(Whiskers("<?c>a<?c>b</c>c</c>")("c", true).render(), "a<?c>bc</c>");
+	std::vector<std::map<std::string, std::string>> list(2);
+	list[0]["x"] = "1";
+	list[1]["x"] = "2";
+	BOOST_CHECK_EQUAL(Whiskers("<#l><x></l></l>")("l", list).render(), "12</l>");
+}
+
+BOOST_AUTO_TEST_CASE(unclosed_conditional_rendered)
+{
+	std::string templ = "<?c>a<!c>b";
+	BOOST_CHECK_EQUAL(Whiskers(templ).render(), templ);
+}
+
+BOOST_AUTO_TEST_CASE(list_values_not_rendered_again)
+{
+	std::vector<std::map<std::string, std::string>> list(2);
+	list[0]["x"] = "1";
+	list[1]["x"] = "<x>";
+	BOOST_CHECK_EQUAL(Whiskers("x<#l>(<x><a>)</l>y")("a", "A")("l", list).render(), "x(1A)(<x>A)y");
+	BOOST_CHECK_EQUAL(Whiskers("<#l>\n<?+x>[<x>]</+x>\n</l>")("l", list).render(), "\n[1]\n\n[<x>]\n");
+}
+
+BOOST_AUTO_TEST_CASE(consecutive_conditionals)
+{
+	std::string templ = "<?c>1<!c>2</c><?d>3<!d>4</d><?d>5</d>";
+	BOOST_CHECK_EQUAL(Whiskers(templ)("c", true)("d", false).render(), "14");
+}
+
+BOOST_AUTO_TEST_CASE(conditional_plus_params_and_list)
+{
+	std::vector<std::map<std::string, std::string>> list(2);
+	list[0]["x"] = "1";
+	list[1]["x"] = "<x>";
+	std::string templ = "<?+a><a><!+a>-</+a><?+b><b><!+b>-</+b><?+l><#l><x></l></+l>";
+	BOOST_CHECK_EQUAL(Whiskers(templ)("a", "A")("b", "")("l", list).render(), "A-1<x>");
+}
+
+BOOST_AUTO_TEST_CASE(conditional_in_list_in_conditional)
+{
+	std::vector<std::map<std::string, std::string>> list(2);
+	list[0]["x"] = "1";
+	list[1]["x"] = "2";
+	std::string templ = "<?c><#l><?d><x><!d><y></d></l></c>\r\n<a >< a><$";
+	BOOST_CHECK_EQUAL(
+		Whiskers(templ)("c", true)("d", false)("y", "Y")("l", list).render(),
+		"YY\r\n<a >< a><$"
+	);
+}
+
+BOOST_AUTO_TEST_CASE(same_template_different_values)
+{
+	std::string templ = "<?c><a><!c>-</c>";
+	BOOST_CHECK_EQUAL(Whiskers(templ)("c", true)("a", "A").render(), "A");
+	BOOST_CHECK_EQUAL(Whiskers(templ)("c", false)("a", "A").render(), "-");
+	BOOST_CHECK_EQUAL(Whiskers(templ)("c", true)("a", "B").render(), "B");
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }
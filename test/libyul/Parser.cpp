@@ -196,6 +196,25 @@ BOOST_AUTO_TEST_CASE(default_types_set)
 	);
 }
 
+BOOST_AUTO_TEST_CASE(location_override_shares_debug_data)
+{
+	ErrorList errorList;
+	ErrorReporter reporter(errorList);
+	auto sourceName = std::make_shared<std::string const>("source0");
+	SourceLocation location{7, 42, sourceName};
+	CharStream stream("{ let x := add(1, 2) if x { x := 0 } }", "");
+	std::unique_ptr<Block> result = yul::Parser(reporter, EVMDialectTyped::instance(EVMVersion{}), location).parse(stream);
+	BOOST_REQUIRE(!!result && errorList.size() == 0);
+
+	auto const& declaration = std::get<VariableDeclaration>(result->statements.at(0));
+	auto const& condition = std::get<If>(result->statements.at(1));
+	BOOST_CHECK(result->debugData == declaration.debugData);
+	BOOST_CHECK(result->debugData == debugDataOf(*declaration.value));
+	BOOST_CHECK(result->debugData == condition.body.debugData);
+	BOOST_CHECK(result->debugData->nativeLocation == location);
+	BOOST_CHECK(result->debugData->originLocation == location);
+}
+
 #define CHECK_LOCATION(_actual, _sourceName, _start, _end) \
 	do { \
 		BOOST_CHECK_EQUAL((_sourceName), ((_actual).sourceName ? *(_actual).sourceName : "")); \
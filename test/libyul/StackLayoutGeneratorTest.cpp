@@ -129,12 +129,12 @@ private:
 				}
 			}, entry->exit);
 
-		auto const& blockInfo = m_stackLayout.blockInfos.at(&_block);
+		auto const& blockInfo = m_stackLayout.blockInfo(_block);
 		m_stream << stackToString(blockInfo.entryLayout) << "\\l\\\n";
 		for (auto const& operation: _block.operations)
 		{
-			auto entryLayout = m_stackLayout.operationEntryLayout.at(&operation);
-			m_stream << stackToString(m_stackLayout.operationEntryLayout.at(&operation)) << "\\l\\\n";
+			auto entryLayout = m_stackLayout.operationEntryLayout(operation);
+			m_stream << stackToString(m_stackLayout.operationEntryLayout(operation)) << "\\l\\\n";
 			std::visit(util::GenericVisitor{
 				[&](CFG::FunctionCall const& _call) {
 					m_stream << _call.function.get().name.str();
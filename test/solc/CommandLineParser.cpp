@@ -132,6 +132,9 @@ BOOST_AUTO_TEST_CASE(cli_mode_options)
 			"--ast-compact-json", "--asm", "--asm-json", "--opcodes", "--bin", "--bin-runtime", "--abi",
 			"--ir", "--ir-ast-json", "--ir-optimized", "--ir-optimized-ast-json", "--hashes", "--userdoc", "--devdoc", "--metadata", "--storage-layout",
 			"--gas",
+			"--gas-max-paths=100",
+			"--time-passes",
+			"--jobs=4",
 			"--combined-json="
 				"abi,metadata,bin,bin-runtime,opcodes,asm,storage-layout,generated-sources,generated-sources-runtime,"
 				"srcmap,srcmap-runtime,function-debug,function-debug-runtime,hashes,devdoc,userdoc,ast",
@@ -142,11 +145,14 @@ BOOST_AUTO_TEST_CASE(cli_mode_options)
 			"--optimize-runs=1000",
 			"--yul-optimizations=agf",
 			"--model-checker-bmc-loop-iterations=2",
+			"--model-checker-cache-dir=/tmp/smt-cache",
 			"--model-checker-contracts=contract1.yul:A,contract2.yul:B",
 			"--model-checker-div-mod-no-slacks",
 			"--model-checker-engine=bmc",
 			"--model-checker-ext-calls=trusted",
 			"--model-checker-invariants=contract,reentrancy",
+			"--model-checker-jobs=4",
+			"--model-checker-print-stats",
 			"--model-checker-show-proved-safe",
 			"--model-checker-show-unproved",
 			"--model-checker-show-unsupported",
@@ -195,6 +201,9 @@ BOOST_AUTO_TEST_CASE(cli_mode_options)
 			true,
 		};
 		expectedOptions.compiler.estimateGas = true;
+		expectedOptions.compiler.timePasses = true;
+		expectedOptions.compiler.jobs = 4;
+		expectedOptions.compiler.gasMaxPaths = 100;
 		expectedOptions.compiler.combinedJsonRequests = {
 			true, true, true, true, true,
 			true, true, true, true, true,
@@ -211,12 +220,15 @@ BOOST_AUTO_TEST_CASE(cli_mode_options)
 		expectedOptions.modelChecker.initialize = true;
 		expectedOptions.modelChecker.settings = {
 			2,
+			"/tmp/smt-cache", // --model-checker-cache-dir
 			{{{"contract1.yul", {"A"}}, {"contract2.yul", {"B"}}}},
 			true,
 			{true, false},
 			{ModelCheckerExtCalls::Mode::TRUSTED},
 			{{InvariantType::Contract, InvariantType::Reentrancy}},
+			4, // --model-checker-jobs
 			false, // --model-checker-print-query
+			true, // --model-checker-print-stats
 			true,
 			true,
 			true,
@@ -431,6 +443,11 @@ BOOST_AUTO_TEST_CASE(invalid_options_input_modes_combinations)
 		{"--model-checker-div-mod-no-slacks", {"--assemble", "--yul", "--strict-assembly", "--standard-json", "--link"}},
 		{"--model-checker-engine=bmc", {"--assemble", "--yul", "--strict-assembly", "--standard-json", "--link"}},
 		{"--model-checker-invariants=contract,reentrancy", {"--assemble", "--yul", "--strict-assembly", "--standard-json", "--link"}},
+		{"--model-checker-cache-dir=/tmp/smt-cache", {"--assemble", "--yul", "--strict-assembly", "--standard-json", "--link"}},
+		{"--model-checker-print-stats", {"--assemble", "--yul", "--strict-assembly", "--standard-json", "--link"}},
+		{"--model-checker-jobs=4", {"--assemble", "--yul", "--strict-assembly", "--standard-json", "--link"}},
+		{"--jobs=4", {"--assemble", "--yul", "--strict-assembly", "--standard-json", "--link"}},
+		{"--gas-max-paths=100", {"--assemble", "--yul", "--strict-assembly", "--standard-json", "--link"}},
 		{"--model-checker-solvers=z3,smtlib2", {"--assemble", "--yul", "--strict-assembly", "--standard-json", "--link"}},
 		{"--model-checker-timeout=5", {"--assemble", "--yul", "--strict-assembly", "--standard-json", "--link"}},
 		{"--model-checker-contracts=contract1.yul:A,contract2.yul:B", {"--assemble", "--yul", "--strict-assembly", "--standard-json", "--link"}},
@@ -628,6 +645,39 @@ BOOST_AUTO_TEST_CASE(invalid_optimizer_sequence_without_optimize)
 	}
 }
 
+BOOST_AUTO_TEST_CASE(invalid_number_of_jobs)
+{
+	std::map<std::string, std::string> const invalidJobs{
+		{"0", "Invalid option for --jobs: the number of jobs must be positive."},
+		{"257", "Invalid option for --jobs: the number of jobs must not be greater than 256."}
+	};
+
+	for (auto const& [jobs, expectedErrorMessage]: invalidJobs)
+	{
+		auto hasCorrectMessage = [&](CommandLineValidationError const& _exception) { return _exception.what() == expectedErrorMessage; };
+		BOOST_CHECK_EXCEPTION(parseCommandLine({"solc", "contract.sol", "--jobs=" + jobs}), CommandLineValidationError, hasCorrectMessage);
+	}
+	BOOST_CHECK_EQUAL(parseCommandLine({"solc", "contract.sol", "--jobs=256"}).compiler.jobs, 256);
+}
+
+BOOST_AUTO_TEST_CASE(invalid_number_of_model_checker_jobs)
+{
+	std::map<std::string, std::string> const invalidJobs{
+		{"0", "Invalid option for --model-checker-jobs: the number of jobs must be positive."},
+		{"257", "Invalid option for --model-checker-jobs: the number of jobs must not be greater than 256."}
+	};
+
+	for (auto const& [jobs, expectedErrorMessage]: invalidJobs)
+	{
+		auto hasCorrectMessage = [&](CommandLineValidationError const& _exception) { return _exception.what() == expectedErrorMessage; };
+		BOOST_CHECK_EXCEPTION(
+			parseCommandLine({"solc", "contract.sol", "--model-checker-jobs=" + jobs}),
+			CommandLineValidationError,
+			hasCorrectMessage
+		);
+	}
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // namespace solidity::frontend::test
@@ -106,12 +106,15 @@ void FuzzerUtil::testCompiler(
 		forceSMT(_input);
 		compiler.setModelCheckerSettings({
 			/*bmcLoopIterations*/1,
+			/*cacheDirectory=*/std::nullopt,
 			frontend::ModelCheckerContracts::Default(),
 			/*divModWithSlacks*/true,
 			frontend::ModelCheckerEngine::All(),
 			frontend::ModelCheckerExtCalls{},
 			frontend::ModelCheckerInvariants::All(),
+			/*jobs=*/1,
 			/*printQuery=*/false,
+			/*printStats=*/false,
 			/*showProvedSafe=*/false,
 			/*showUnproved=*/false,
 			/*showUnsupported=*/false,
@@ -0,0 +1,267 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Standalone driver that replays a saved corpus through the ``LLVMFuzzerTestOneInput`` entry point
+ * of an ossfuzz target, without linking against a fuzzing engine.
+ *
+ * Every input is run in a separate forked worker process, so that a crash or a failed differential
+ * check neither aborts the replay nor leaks state (e.g. the EVMHost, the Yul interpreter or the
+ * YulString repository) into the runs of other inputs. Up to ``--jobs`` workers run concurrently.
+ */
+
+#include <libsolutil/CommonIO.h>
+
+#include <boost/exception/diagnostic_information.hpp>
+#include <boost/filesystem.hpp>
+#include <boost/program_options.hpp>
+
+#include <fcntl.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+extern "C" int LLVMFuzzerTestOneInput(uint8_t const* _data, size_t _size);
+
+/// The protobuf based targets reference the mutator of the fuzzing engine, which is never called during a replay.
+extern "C" __attribute__((weak)) size_t LLVMFuzzerMutate(uint8_t*, size_t _size, size_t)
+{
+	return _size;
+}
+
+using namespace solidity;
+using namespace solidity::util;
+
+namespace po = boost::program_options;
+namespace fs = boost::filesystem;
+
+namespace
+{
+
+struct Failure
+{
+	fs::path input;
+	std::string reason;
+};
+
+/// @returns all regular files given in @a _paths, descending into directories, in a deterministic order.
+std::vector<fs::path> collectInputs(std::vector<std::string> const& _paths)
+{
+	std::vector<fs::path> inputs;
+	for (std::string const& path: _paths)
+		if (fs::is_directory(path))
+		{
+			for (fs::directory_entry const& entry: fs::recursive_directory_iterator(path))
+				if (fs::is_regular_file(entry.path()))
+					inputs.emplace_back(entry.path());
+		}
+		else
+			inputs.emplace_back(path);
+	std::sort(inputs.begin(), inputs.end());
+	return inputs;
+}
+
+/// Runs the fuzzer target on the contents of @a _input. Executed in the worker process.
+/// @returns the exit code of the worker.
+int runInput(fs::path const& _input, bool _verbose)
+{
+	if (!_verbose)
+	{
+		// The targets print the programs they generate and the traces they compare.
+		int devNull = open("/dev/null", O_WRONLY);
+		if (devNull >= 0)
+			dup2(devNull, STDOUT_FILENO);
+	}
+
+	std::string data;
+	try
+	{
+		data = readFileAsString(_input);
+	}
+	catch (...)
+	{
+		std::cerr << _input.string() << ": could not be read." << std::endl;
+		return 2;
+	}
+
+	std::string reason;
+	try
+	{
+		LLVMFuzzerTestOneInput(reinterpret_cast<uint8_t const*>(data.data()), data.size());
+		return 0;
+	}
+	catch (boost::exception const& _exception)
+	{
+		reason = boost::diagnostic_information(_exception);
+	}
+	catch (std::exception const& _exception)
+	{
+		reason = _exception.what();
+	}
+	catch (...)
+	{
+		reason = "Unknown exception.";
+	}
+	// Assemble the message first, so that it is not interleaved with the output of other workers.
+	std::cerr << (_input.string() + ": " + reason + "\n") << std::flush;
+	return 1;
+}
+
+}
+
+int main(int argc, char** argv)
+{
+	po::options_description options(
+		R"(Replays a corpus through the linked ossfuzz target in parallel worker processes.
+Usage: <target>_replay [Options] <file or directory>...
+Reports inputs on which the target fails an assertion (e.g. a differential check) or crashes.
+
+Allowed options)",
+		po::options_description::m_default_line_length,
+		po::options_description::m_default_line_length - 23);
+	options.add_options()
+		("help", "Show this help screen.")
+		(
+			"jobs,j",
+			po::value<unsigned>()->default_value(std::max(1u, std::thread::hardware_concurrency())),
+			"Number of inputs replayed concurrently."
+		)
+		("verbose", "Do not suppress the standard output of the fuzzer target.")
+		(
+			"input-paths",
+			po::value<std::vector<std::string>>()->multitoken(),
+			"Input files or directories containing the corpus."
+		);
+
+	po::positional_options_description filesPositions;
+	filesPositions.add("input-paths", -1);
+
+	po::variables_map arguments;
+	try
+	{
+		po::command_line_parser cmdLineParser(argc, argv);
+		cmdLineParser.options(options).positional(filesPositions);
+		po::store(cmdLineParser.run(), arguments);
+		po::notify(arguments);
+	}
+	catch (po::error const& _exception)
+	{
+		std::cerr << _exception.what() << std::endl;
+		return 1;
+	}
+
+	if (arguments.count("help") || !arguments.count("input-paths"))
+	{
+		std::cout << options;
+		return arguments.count("help") ? 0 : 1;
+	}
+
+	bool const verbose = arguments.count("verbose") > 0;
+	size_t const jobs = std::max(1u, arguments["jobs"].as<unsigned>());
+
+	std::vector<fs::path> inputs;
+	try
+	{
+		inputs = collectInputs(arguments["input-paths"].as<std::vector<std::string>>());
+	}
+	catch (fs::filesystem_error const& _exception)
+	{
+		std::cerr << _exception.what() << std::endl;
+		return 1;
+	}
+
+	std::vector<Failure> failures;
+	std::vector<Failure> crashes;
+	std::map<pid_t, size_t> running;
+	size_t next = 0;
+	auto start = std::chrono::steady_clock::now();
+
+	while (next < inputs.size() || !running.empty())
+	{
+		while (next < inputs.size() && running.size() < jobs)
+		{
+			// Flush before forking, so that buffered output is not written twice.
+			std::cout.flush();
+			std::cerr.flush();
+			pid_t pid = fork();
+			if (pid < 0)
+			{
+				std::cerr << "fork failed: " << strerror(errno) << std::endl;
+				return 2;
+			}
+			if (pid == 0)
+			{
+				int exitCode = runInput(inputs[next], verbose);
+				std::cout.flush();
+				std::cerr.flush();
+				_exit(exitCode);
+			}
+			running[pid] = next++;
+		}
+
+		int status = 0;
+		pid_t pid = waitpid(-1, &status, 0);
+		if (pid < 0)
+		{
+			if (errno == EINTR)
+				continue;
+			std::cerr << "waitpid failed: " << strerror(errno) << std::endl;
+			return 2;
+		}
+		auto worker = running.find(pid);
+		if (worker == running.end())
+			continue;
+		fs::path const& input = inputs[worker->second];
+		running.erase(worker);
+
+		if (WIFSIGNALED(status))
+			crashes.push_back({input, "signal " + std::to_string(WTERMSIG(status)) + " (" + strsignal(WTERMSIG(status)) + ")"});
+		else if (WIFEXITED(status) && WEXITSTATUS(status) != 0)
+			failures.push_back({input, "exit code " + std::to_string(WEXITSTATUS(status))});
+	}
+
+	double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	auto byInput = [](Failure const& _a, Failure const& _b) { return _a.input < _b.input; };
+	std::sort(failures.begin(), failures.end(), byInput);
+	std::sort(crashes.begin(), crashes.end(), byInput);
+
+	std::cout << "Replayed " << inputs.size() << " inputs in " << std::fixed << std::setprecision(2) << seconds << " s";
+	if (seconds > 0)
+		std::cout << " (" << std::setprecision(1) << static_cast<double>(inputs.size()) / seconds << " inputs/s)";
+	std::cout << " using " << jobs << " worker(s)." << std::endl;
+
+	for (auto const& [title, entries]: {std::make_pair("Failed", &failures), std::make_pair("Crashed", &crashes)})
+		if (!entries->empty())
+		{
+			std::cout << title << ": " << entries->size() << std::endl;
+			for (Failure const& entry: *entries)
+				std::cout << "  " << entry.input.string() << ": " << entry.reason << std::endl;
+		}
+
+	return failures.empty() && crashes.empty() ? 0 : 1;
+}